@@ -0,0 +1,58 @@
+#include "allocation_counter.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace graph {
+namespace {
+
+constexpr auto HEADER_SIZE = alignof(std::max_align_t);
+
+auto allocatedBytes = std::atomic<std::size_t>();
+
+auto allocate(std::size_t size) -> void* {
+  auto block = static_cast<char*>(std::malloc(size + HEADER_SIZE));
+  if (!block) {
+    throw std::bad_alloc();
+  }
+  *reinterpret_cast<std::size_t*>(block) = size;
+  allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+  return block + HEADER_SIZE;
+}
+
+void deallocate(void* pointer) {
+  if (!pointer) {
+    return;
+  }
+  auto block = static_cast<char*>(pointer) - HEADER_SIZE;
+  allocatedBytes.fetch_sub(*reinterpret_cast<std::size_t*>(block),
+                           std::memory_order_relaxed);
+  std::free(block);
+}
+
+}  // namespace
+
+auto getAllocatedBytes() -> std::size_t {
+  return allocatedBytes.load(std::memory_order_relaxed);
+}
+
+}  // namespace graph
+
+auto operator new(std::size_t size) -> void* { return graph::allocate(size); }
+
+auto operator new[](std::size_t size) -> void* {
+  return graph::allocate(size);
+}
+
+void operator delete(void* pointer) noexcept { graph::deallocate(pointer); }
+
+void operator delete[](void* pointer) noexcept { graph::deallocate(pointer); }
+
+void operator delete(void* pointer, std::size_t) noexcept {
+  graph::deallocate(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t) noexcept {
+  graph::deallocate(pointer);
+}
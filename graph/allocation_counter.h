@@ -0,0 +1,9 @@
+#pragma once
+
+#include <cstddef>
+
+namespace graph {
+
+auto getAllocatedBytes() -> std::size_t;
+
+}  // namespace graph
@@ -0,0 +1,58 @@
+
+#include <benchmark/benchmark.h>
+
+#include <type_traits>
+
+#include "are_connected.h"
+#include "graph_generators.h"
+
+namespace {
+
+constexpr auto NUM_QUERIES = std::size_t(64);
+constexpr auto EDGES_PER_NODE = std::size_t(4);
+
+template <class GraphT>
+auto createGraph(std::size_t numNodes, std::size_t numEdges,
+                 graph::RandomGenerator *randomGenerator) -> GraphT {
+  auto graph = graph::createRandomGraph(numNodes, numEdges, randomGenerator);
+  if constexpr (std::is_same_v<GraphT, graph::FrozenGraph>) {
+    return graph.freeze();
+  } else {
+    return graph;
+  }
+}
+
+template <class GraphT>
+void BM_AreConnected(benchmark::State &state) {
+  auto numEdges = std::size_t(state.range(0));
+  auto numNodes = numEdges / EDGES_PER_NODE;
+  auto randomGenerator = graph::RandomGenerator(4242);
+  auto graph = createGraph<GraphT>(numNodes, numEdges, &randomGenerator);
+
+  using NodeId = graph::Graph::NodeId;
+  auto queries = std::vector<std::pair<NodeId, NodeId>>();
+  for (auto i = std::size_t(); i < NUM_QUERIES; i++) {
+    queries.emplace_back(randomGenerator() % numNodes,
+                         randomGenerator() % numNodes);
+  }
+
+  auto scratch = graph::AreConnectedScratch();
+  for (auto _ : state) {
+    for (auto [source, destination] : queries) {
+      benchmark::DoNotOptimize(
+          graph::areConnected(graph, source, destination, &scratch));
+    }
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_AreConnected, graph::Graph)
+    ->RangeMultiplier(10)
+    ->Range(100'000, 10'000'000)
+    ->Complexity();
+BENCHMARK_TEMPLATE(BM_AreConnected, graph::FrozenGraph)
+    ->RangeMultiplier(10)
+    ->Range(100'000, 10'000'000)
+    ->Complexity();
@@ -1,162 +1,207 @@
 #include "are_connected.h"
 
 #include <cassert>
-#include <functional>
-#include <memory>
-#include <queue>
-#include <unordered_set>
+#include <utility>
 
 namespace graph {
 namespace {
 
-template <class T>
-using Queue = std::priority_queue<T>;
-
-template <class T>
-using Shared = std::shared_ptr<T>;
-
-template <class T>
-using Set = std::unordered_set<T>;
-
-using Distance = std::size_t;
 using NodeId = Graph::NodeId;
-using NodeIds = Graph::NodeIds;
-using VisitedNodes = Set<NodeId>;
+using Side = AreConnectedScratch::Side;
 
-enum class Status { CONTINUE, FAIL, SUCCESS };
-
-class Task {
+template <class GraphT, bool COLLECT_STATS = false>
+class BidirectionalSearch {
  public:
-  Task() = default;
-
-  using FindNodes = std::function<const NodeIds&(NodeId)>;
+  BidirectionalSearch(const GraphT& graph, NodeId source, NodeId destination,
+                      AreConnectedScratch* scratch,
+                      SearchStats* stats = nullptr);
 
-  Task(FindNodes findNodes, Shared<VisitedNodes> visitedFromSource,
-       Shared<VisitedNodes> visitedFromDestination, NodeId source,
-       NodeId destination, Distance distance);
-  Task(const Task& other) = default;
-  ~Task() = default;
-
-  auto operator=(const Task& other) -> Task& = default;
-  bool operator<(const Task& other) const {
-    return other.distance_ < distance_;
-  }
-
-  static auto start(const Graph& graph, NodeId source, NodeId destination,
-                    Queue<Task>* taskQueue) -> Status;
-  static auto createVisitedNodes(NodeId firstNode, const NodeIds& nextNodes)
-      -> Shared<VisitedNodes>;
-
-  auto execute(Queue<Task>* taskQueue) const -> Status;
+  bool run();
 
  private:
-  FindNodes findNodes_{};
-  Shared<VisitedNodes> visitedFromSource_{};
-  Shared<VisitedNodes> visitedFromDestination_{};
-
+  const GraphT* graph_{};
   NodeId source_{};
   NodeId destination_{};
-  Distance distance_{};
+  AreConnectedScratch* scratch_{};
+  SearchStatsRecorder<COLLECT_STATS> recorder_;
+
+  bool finish(SearchOutcome outcome);
+
+  template <Side side>
+  bool expand();
+
+  template <Side side>
+  decltype(auto) findNextNodes(NodeId nodeId) const;
 };
 
-Task::Task(FindNodes findNodes, Shared<VisitedNodes> visitedFromSource,
-           Shared<VisitedNodes> visitedFromDestination, NodeId source,
-           NodeId destination, Distance distance)
-    : findNodes_(std::move(findNodes)),
-      visitedFromSource_(std::move(visitedFromSource)),
-      visitedFromDestination_(std::move(visitedFromDestination)),
+template <class GraphT, bool COLLECT_STATS>
+BidirectionalSearch<GraphT, COLLECT_STATS>::BidirectionalSearch(
+    const GraphT& graph, NodeId source, NodeId destination,
+    AreConnectedScratch* scratch, SearchStats* stats)
+    : graph_(&graph),
       source_(source),
       destination_(destination),
-      distance_(distance) {
-  assert(findNodes_ != nullptr);
-  assert(visitedFromSource_ != nullptr);
-  assert(visitedFromDestination_ != nullptr);
+      scratch_(scratch),
+      recorder_(stats) {
+  assert(scratch_ != nullptr);
 }
 
-auto Task::start(const Graph& graph, NodeId source, NodeId destination,
-                 Queue<Task>* taskQueue) -> Status {
-  const auto& nodesFromSource = graph.findNodesBySource(source);
-  if (nodesFromSource.empty()) {
-    return Status::FAIL;
-  } else if (nodesFromSource.count(destination)) {
-    return Status::SUCCESS;
+template <class GraphT, bool COLLECT_STATS>
+bool BidirectionalSearch<GraphT, COLLECT_STATS>::run() {
+  auto numNodes = graph_->numNodes();
+  if (source_ >= numNodes || destination_ >= numNodes) {
+    return finish(SearchOutcome::EARLY_FAIL);
   }
 
-  const auto& nodesFromDestination = graph.findNodesBySource(destination);
-  if (nodesFromDestination.empty()) {
-    return Status::FAIL;
+  scratch_->reset(numNodes);
+  scratch_->frontier(Side::FORWARD).push_back(source_);
+  scratch_->frontier(Side::BACKWARD).push_back(destination_);
+  recorder_.updateQueueSize(2);
+
+  if (expand<Side::BACKWARD>()) return finish(SearchOutcome::FOUND);
+  if (expand<Side::FORWARD>()) return finish(SearchOutcome::FOUND);
+
+  auto& forwardFrontier = scratch_->frontier(Side::FORWARD);
+  auto& backwardFrontier = scratch_->frontier(Side::BACKWARD);
+  while (!forwardFrontier.empty() && !backwardFrontier.empty()) {
+    auto found = forwardFrontier.size() <= backwardFrontier.size()
+                     ? expand<Side::FORWARD>()
+                     : expand<Side::BACKWARD>();
+    if (found) return finish(SearchOutcome::FOUND);
   }
 
-  auto visitedFromSource = Task::createVisitedNodes(source, nodesFromSource);
-  auto visitedFromDestination =
-      Task::createVisitedNodes(destination, nodesFromDestination);
-
-  auto findNodesBySource = [&graph](NodeId nodeId) {
-    return graph.findNodesBySource(nodeId);
-  };
-  auto findNodesByDestination = [&graph](NodeId nodeId) {
-    return graph.findNodesByDestination(nodeId);
-  };
-
-  auto INITIAL_DISTANCE = Distance(1);
-  for (auto nextNodeFromSource : nodesFromSource) {
-    taskQueue->emplace(findNodesBySource, visitedFromSource,
-                       visitedFromDestination, nextNodeFromSource, destination,
-                       INITIAL_DISTANCE);
-  }
-  for (auto nextNodeFromDestination : nodesFromDestination) {
-    taskQueue->emplace(findNodesByDestination, visitedFromDestination,
-                       visitedFromSource, nextNodeFromDestination, source,
-                       INITIAL_DISTANCE);
-  }
+  return finish(SearchOutcome::EXHAUSTED);
+}
 
-  return Status::CONTINUE;
+template <class GraphT, bool COLLECT_STATS>
+bool BidirectionalSearch<GraphT, COLLECT_STATS>::finish(
+    SearchOutcome outcome) {
+  recorder_.finish(outcome);
+  return outcome == SearchOutcome::FOUND;
 }
 
-auto Task::createVisitedNodes(NodeId firstNode, const NodeIds& nextNodes)
-    -> Shared<VisitedNodes> {
-  auto visitedNodes = std::make_shared<VisitedNodes>();
+template <class GraphT, bool COLLECT_STATS>
+template <Side side>
+bool BidirectionalSearch<GraphT, COLLECT_STATS>::expand() {
+  constexpr auto otherSide =
+      side == Side::FORWARD ? Side::BACKWARD : Side::FORWARD;
+  auto target = side == Side::FORWARD ? destination_ : source_;
+
+  auto& nextFrontier = scratch_->nextFrontier();
+  for (auto nodeId : scratch_->frontier(side)) {
+    recorder_.expandNode();
+    for (auto nextNodeId : findNextNodes<side>(nodeId)) {
+      recorder_.scanEdge();
+      if (!scratch_->visit(side, nextNodeId)) continue;
+      recorder_.visitState();
+      if (nextNodeId == target || scratch_->isVisited(otherSide, nextNodeId)) {
+        return true;
+      }
+      nextFrontier.push_back(nextNodeId);
+    }
+  }
+  recorder_.updateQueueSize(scratch_->frontier(otherSide).size() +
+                            nextFrontier.size());
+  scratch_->swapFrontiers(side);
+
+  return false;
+}
 
-  visitedNodes->insert(firstNode);
-  for (auto nodeId : nextNodes) {
-    visitedNodes->insert(nodeId);
+template <class GraphT, bool COLLECT_STATS>
+template <Side side>
+decltype(auto) BidirectionalSearch<GraphT, COLLECT_STATS>::findNextNodes(
+    NodeId nodeId) const {
+  if constexpr (side == Side::FORWARD) {
+    return graph_->findNodesBySource(nodeId);
+  } else {
+    return graph_->findNodesByDestination(nodeId);
   }
+}
 
-  return visitedNodes;
+template <class GraphT>
+bool searchConnectionWithStats(const GraphT& graph, NodeId source,
+                               NodeId destination,
+                               AreConnectedScratch* scratch,
+                               SearchStats* stats) {
+  if (stats) {
+    return BidirectionalSearch<GraphT, true>(graph, source, destination,
+                                             scratch, stats)
+        .run();
+  } else {
+    return BidirectionalSearch<GraphT>(graph, source, destination, scratch)
+        .run();
+  }
 }
 
-auto Task::execute(Queue<Task>* taskQueue) const -> Status {
-  const auto& nextNodes = findNodes_(source_);
-  if (nextNodes.empty()) return Status::CONTINUE;
-  if (nextNodes.count(destination_)) return Status::SUCCESS;
+template <class GraphT>
+bool searchConnection(const GraphT& graph, NodeId source, NodeId destination,
+                      AreConnectedScratch* scratch, SearchStats* stats) {
+  if (scratch) {
+    return searchConnectionWithStats(graph, source, destination, scratch,
+                                     stats);
+  } else {
+    auto localScratch = AreConnectedScratch();
+    return searchConnectionWithStats(graph, source, destination,
+                                     &localScratch, stats);
+  }
+}
 
-  for (auto nodeId : nextNodes) {
-    if (visitedFromDestination_->count(nodeId)) return Status::SUCCESS;
+}  // namespace
 
-    auto [_, firstVisit] = visitedFromSource_->emplace(nodeId);
-    if (firstVisit) {
-      taskQueue->emplace(findNodes_, visitedFromSource_,
-                         visitedFromDestination_, nodeId, destination_,
-                         distance_ + 1);
+void AreConnectedScratch::reset(std::size_t numNodes) {
+  epoch_++;
+  for (auto& visitEpochs : visitEpochs_) {
+    if (epoch_ == 0) {
+      visitEpochs.assign(visitEpochs.size(), 0);
     }
+    visitEpochs.resize(numNodes);
+  }
+  if (epoch_ == 0) {
+    epoch_++;
   }
 
-  return Status::CONTINUE;
+  for (auto& frontier : frontiers_) {
+    frontier.clear();
+  }
+  nextFrontier_.clear();
 }
 
-}  // namespace
-
-bool areConnected(const Graph& graph, NodeId source, NodeId destination) {
-  auto taskQueue = Queue<Task>();
-  auto status = Task::start(graph, source, destination, &taskQueue);
-  while (status == Status::CONTINUE  //
-         && !taskQueue.empty()) {
-    auto task = std::move(taskQueue.top());
-    taskQueue.pop();
-    status = task.execute(&taskQueue);
+bool AreConnectedScratch::visit(Side side, NodeId nodeId) {
+  auto& visitEpoch = visitEpochs_[std::size_t(side)][nodeId];
+  if (visitEpoch == epoch_) {
+    return false;
   }
+  visitEpoch = epoch_;
+  return true;
+}
+
+bool AreConnectedScratch::isVisited(Side side, NodeId nodeId) const {
+  return visitEpochs_[std::size_t(side)][nodeId] == epoch_;
+}
+
+auto AreConnectedScratch::frontier(Side side) -> Frontier& {
+  return frontiers_[std::size_t(side)];
+}
+
+void AreConnectedScratch::swapFrontiers(Side side) {
+  std::swap(frontiers_[std::size_t(side)], nextFrontier_);
+  nextFrontier_.clear();
+}
+
+bool areConnected(const Graph& graph, NodeId source, NodeId destination,
+                  AreConnectedScratch* scratch, SearchStats* stats) {
+  return searchConnection(graph, source, destination, scratch, stats);
+}
+
+bool areConnected(const FrozenGraph& graph, NodeId source, NodeId destination,
+                  AreConnectedScratch* scratch, SearchStats* stats) {
+  return searchConnection(graph, source, destination, scratch, stats);
+}
 
-  return bool(status == Status::SUCCESS);
+bool areConnected(const ConcurrentGraph::Snapshot& graph, NodeId source,
+                  NodeId destination, AreConnectedScratch* scratch,
+                  SearchStats* stats) {
+  return searchConnection(graph, source, destination, scratch, stats);
 }
 
 }  // namespace graph
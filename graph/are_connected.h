@@ -1,10 +1,51 @@
 #pragma once
 
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "concurrent_graph.h"
+#include "frozen_graph.h"
 #include "graph.h"
+#include "search_stats.h"
 
 namespace graph {
 
-bool areConnected(const Graph& graph, Graph::NodeId source,
-                  Graph::NodeId destination);
+class AreConnectedScratch {
+ public:
+  using NodeId = Graph::NodeId;
+  using Frontier = std::vector<NodeId>;
+  enum class Side { FORWARD, BACKWARD };
+
+  void reset(std::size_t numNodes);
+  bool visit(Side side, NodeId nodeId);
+  bool isVisited(Side side, NodeId nodeId) const;
+
+  auto frontier(Side side) -> Frontier &;
+  auto nextFrontier() -> Frontier & { return nextFrontier_; }
+  void swapFrontiers(Side side);
+
+ private:
+  using Epoch = std::uint32_t;
+
+  Epoch epoch_{};
+  std::array<std::vector<Epoch>, 2> visitEpochs_{};
+  std::array<Frontier, 2> frontiers_{};
+  Frontier nextFrontier_{};
+};
+
+bool areConnected(const Graph &graph, Graph::NodeId source,
+                  Graph::NodeId destination,
+                  AreConnectedScratch *scratch = nullptr,
+                  SearchStats *stats = nullptr);
+bool areConnected(const FrozenGraph &graph, FrozenGraph::NodeId source,
+                  FrozenGraph::NodeId destination,
+                  AreConnectedScratch *scratch = nullptr,
+                  SearchStats *stats = nullptr);
+bool areConnected(const ConcurrentGraph::Snapshot &graph,
+                  ConcurrentGraph::NodeId source,
+                  ConcurrentGraph::NodeId destination,
+                  AreConnectedScratch *scratch = nullptr,
+                  SearchStats *stats = nullptr);
 
 }  // namespace graph
@@ -0,0 +1,183 @@
+
+#include <gtest/gtest.h>
+
+#include "are_connected.h"
+#include "graph_generators.h"
+
+namespace graph {
+namespace {
+
+using NodeId = Graph::NodeId;
+using Edge = std::pair<NodeId, NodeId>;
+using Edges = std::vector<Edge>;
+
+struct TestCase_AreConnected {
+  std::string name{};
+  std::size_t numNodes{};
+  Edges edges{};
+  NodeId source{};
+  NodeId destination{};
+  bool expectedResult{};
+};
+
+}  // namespace
+
+class TestAreConnected
+    : public ::testing::TestWithParam<TestCase_AreConnected> {
+ public:
+  using TestCase = TestCase_AreConnected;
+
+  static auto getTestName(const ::testing::TestParamInfo<TestCase> &testInfo)
+      -> std::string {
+    return testInfo.param.name;
+  }
+
+ protected:
+  auto createGraph() const -> Graph;
+};
+
+INSTANTIATE_TEST_SUITE_P(
+    TestAreConnected, TestAreConnected,
+    testing::Values(
+
+        TestAreConnected::TestCase{"invalidNodes", 2, Edges{{0, 1}}, 0, 2,
+                                   false},
+        TestAreConnected::TestCase{"singleNode", 1, Edges{}, 0, 0, false},
+        TestAreConnected::TestCase{"selfLoop", 1, Edges{{0, 0}}, 0, 0, true},
+        TestAreConnected::TestCase{"oneEdge", 2, Edges{{0, 1}}, 0, 1, true},
+        TestAreConnected::TestCase{"oneEdgeReversed", 2, Edges{{0, 1}}, 1, 0,
+                                   false},
+        TestAreConnected::TestCase{"sinkDestination", 3,
+                                   Edges{{0, 1}, {1, 2}}, 0, 2, true},
+        TestAreConnected::TestCase{"sharedSuccessor", 3,
+                                   Edges{{0, 2}, {1, 2}}, 0, 1, false},
+        TestAreConnected::TestCase{"cycle", 3,
+                                   Edges{{0, 1}, {1, 2}, {2, 0}}, 1, 1, true},
+        TestAreConnected::TestCase{
+            "longChain", 8,
+            Edges{{0, 1}, {1, 2}, {2, 3}, {3, 4}, {4, 5}, {5, 6}, {6, 7}}, 0,
+            7, true},
+        TestAreConnected::TestCase{
+            "twoComponents", 6,
+            Edges{{0, 1}, {1, 2}, {2, 0}, {3, 4}, {4, 5}, {5, 3}}, 0, 4,
+            false}
+
+        ),
+    &TestAreConnected::getTestName);
+
+TEST_P(TestAreConnected, testAreConnected) {
+  const auto &testCase = GetParam();
+
+  auto graph = createGraph();
+  EXPECT_EQ(testCase.expectedResult,
+            areConnected(graph, testCase.source, testCase.destination));
+  EXPECT_EQ(testCase.expectedResult,
+            areConnected(graph.freeze(), testCase.source,
+                         testCase.destination));
+}
+
+TEST_P(TestAreConnected, testAreConnectedWithStats) {
+  const auto &testCase = GetParam();
+
+  auto graph = createGraph();
+  auto stats = SearchStats();
+  EXPECT_EQ(testCase.expectedResult,
+            areConnected(graph, testCase.source, testCase.destination,
+                         nullptr, &stats));
+  EXPECT_EQ(testCase.expectedResult, stats.outcome == SearchOutcome::FOUND);
+  EXPECT_LE(stats.visitedStates, 2 * graph.numNodes());
+  EXPECT_LE(stats.edgesScanned, 2 * testCase.edges.size());
+}
+
+auto TestAreConnected::createGraph() const -> Graph {
+  const auto &testCase = GetParam();
+
+  auto graph = Graph();
+  for (auto i = std::size_t(); i < testCase.numNodes; i++) {
+    graph.addNode(Color::Black);
+  }
+  for (auto [source, destination] : testCase.edges) {
+    graph.addEdge(source, destination);
+  }
+  return graph;
+}
+
+// --- TestAreConnected_Stats ---
+
+TEST(TestAreConnected_Stats, testStats) {
+  auto graph = Graph();
+  for (auto i = 0; i < 4; i++) {
+    graph.addNode(Color::Black);
+  }
+  graph.addEdge(0, 1);
+  graph.addEdge(1, 2);
+  graph.addEdge(2, 3);
+
+  auto stats = SearchStats();
+  EXPECT_TRUE(areConnected(graph, 0, 3, nullptr, &stats));
+  EXPECT_EQ(SearchOutcome::FOUND, stats.outcome);
+  EXPECT_EQ(3, stats.nodesExpanded);
+  EXPECT_EQ(3, stats.edgesScanned);
+  EXPECT_EQ(3, stats.visitedStates);
+  EXPECT_EQ(2, stats.peakQueueSize);
+
+  EXPECT_FALSE(areConnected(graph, 3, 0, nullptr, &stats));
+  EXPECT_EQ(SearchOutcome::EXHAUSTED, stats.outcome);
+
+  EXPECT_FALSE(areConnected(graph, 0, 4, nullptr, &stats));
+  EXPECT_EQ(SearchOutcome::EARLY_FAIL, stats.outcome);
+  EXPECT_EQ(0, stats.edgesScanned);
+}
+
+// --- TestAreConnected_RandomGraph ---
+
+class TestAreConnected_RandomGraph
+    : public ::testing::TestWithParam<std::size_t> {
+ protected:
+  static auto findReachableNodes(const Graph &graph, NodeId source)
+      -> std::vector<bool>;
+};
+
+INSTANTIATE_TEST_SUITE_P(TestAreConnected_RandomGraph,
+                         TestAreConnected_RandomGraph,
+                         ::testing::Values(10, 100, 1'000));
+
+TEST_P(TestAreConnected_RandomGraph, testRandomGraph) {
+  auto numNodes = GetParam();
+  auto randomGenerator = RandomGenerator(4242);
+  auto graph = createRandomGraph(numNodes, numNodes, &randomGenerator);
+  auto frozenGraph = graph.freeze();
+
+  auto scratch = AreConnectedScratch();
+  for (auto source = NodeId(); source < numNodes; source += 1 + numNodes / 20) {
+    auto reachableNodes = findReachableNodes(graph, source);
+    for (auto destination = NodeId(); destination < numNodes; destination++) {
+      EXPECT_EQ(reachableNodes[destination],
+                areConnected(graph, source, destination, &scratch))
+          << source << " -> " << destination;
+      EXPECT_EQ(reachableNodes[destination],
+                areConnected(frozenGraph, source, destination, &scratch))
+          << source << " -> " << destination;
+    }
+  }
+}
+
+auto TestAreConnected_RandomGraph::findReachableNodes(const Graph &graph,
+                                                      NodeId source)
+    -> std::vector<bool> {
+  auto reachableNodes = std::vector<bool>(graph.numNodes());
+  auto stack = std::vector<NodeId>{source};
+  while (!stack.empty()) {
+    auto nodeId = stack.back();
+    stack.pop_back();
+    for (auto nextNodeId : graph.findNodesBySource(nodeId)) {
+      if (!reachableNodes[nextNodeId]) {
+        reachableNodes[nextNodeId] = true;
+        stack.push_back(nextNodeId);
+      }
+    }
+  }
+  return reachableNodes;
+}
+
+}  // namespace graph
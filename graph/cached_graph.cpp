@@ -0,0 +1,168 @@
+#include "cached_graph.h"
+
+#include <vector>
+
+namespace graph {
+
+auto CachedGraph::addNode(Color color) -> NodeId {
+  auto nodeId = graph_.addNode(color);
+
+  auto singleColorKey = makeKey(ColorList{color});
+  stats_.invalidations += missingColorLists_.erase(singleColorKey);
+
+  return nodeId;
+}
+
+void CachedGraph::addEdge(NodeId source, NodeId destination,
+                          Graph::Weight weight) {
+  graph_.addEdge(source, destination, weight);
+
+  stats_.invalidations += missingColorLists_.size();
+  missingColorLists_.clear();
+
+  invalidateReachableNodes(source);
+}
+
+void CachedGraph::removeEdge(NodeId source, NodeId destination) {
+  graph_.removeEdge(source, destination);
+
+  invalidateFoundAnswers();
+  invalidateReachableNodes(source);
+}
+
+void CachedGraph::removeNode(NodeId nodeId) {
+  graph_.removeNode(nodeId);
+
+  invalidateFoundAnswers();
+  invalidateReachableNodes(nodeId);
+}
+
+auto CachedGraph::compact() -> Graph::NodeList {
+  auto newNodeIds = graph_.compact();
+  auto isKept = [&newNodeIds](NodeId nodeId) {
+    return nodeId < newNodeIds.size() &&
+           newNodeIds[nodeId] != Graph::NO_NODE_ID;
+  };
+
+  auto connectedNodes = NodePairs();
+  for (auto [source, destination] : connectedNodes_) {
+    if (isKept(source) && isKept(destination)) {
+      connectedNodes.emplace(newNodeIds[source], newNodeIds[destination]);
+    }
+  }
+  connectedNodes_ = std::move(connectedNodes);
+
+  auto reachableNodesBySource = std::unordered_map<NodeId, Graph::NodeIds>();
+  for (const auto& [source, reachableNodes] : reachableNodesBySource_) {
+    if (!isKept(source)) {
+      continue;
+    }
+    auto& newReachableNodes = reachableNodesBySource[newNodeIds[source]];
+    newReachableNodes.reserve(reachableNodes.size());
+    for (auto nodeId : reachableNodes) {
+      if (isKept(nodeId)) {
+        newReachableNodes.insert(newNodeIds[nodeId]);
+      }
+    }
+  }
+  reachableNodesBySource_ = std::move(reachableNodesBySource);
+
+  areConnectedScratch_ = AreConnectedScratch();
+  hasPathScratch_ = HasPathScratch();
+  return newNodeIds;
+}
+
+bool CachedGraph::hasPath(const ColorList& colorList) {
+  auto key = makeKey(colorList);
+  if (foundColorLists_.count(key)) {
+    stats_.hits++;
+    return true;
+  }
+  if (missingColorLists_.count(key)) {
+    stats_.hits++;
+    return false;
+  }
+
+  stats_.misses++;
+  auto found = graph::hasPath(graph_, colorList, &hasPathScratch_);
+  if (found) {
+    foundColorLists_.emplace(std::move(key));
+  } else {
+    missingColorLists_.emplace(std::move(key));
+  }
+  return found;
+}
+
+bool CachedGraph::areConnected(NodeId source, NodeId destination) {
+  auto nodePair = std::make_pair(source, destination);
+  if (connectedNodes_.count(nodePair)) {
+    stats_.hits++;
+    return true;
+  }
+  auto reachableIt = reachableNodesBySource_.find(source);
+  if (reachableIt != reachableNodesBySource_.end()) {
+    stats_.hits++;
+    return reachableIt->second.count(destination) != 0;
+  }
+
+  stats_.misses++;
+  auto connected =
+      graph::areConnected(graph_, source, destination, &areConnectedScratch_);
+  if (connected) {
+    connectedNodes_.emplace(nodePair);
+  } else if (source < graph_.numNodes()) {
+    reachableNodesBySource_.emplace(source, findReachableNodes(source));
+  }
+  return connected;
+}
+
+auto CachedGraph::NodePairHash::operator()(
+    const std::pair<NodeId, NodeId>& nodePair) const -> std::size_t {
+  auto hash = std::hash<NodeId>();
+  return hash(nodePair.first) * 31 + hash(nodePair.second);
+}
+
+auto CachedGraph::makeKey(const ColorList& colorList) -> ColorListKey {
+  auto key = ColorListKey();
+  key.reserve(colorList.size());
+  for (auto color : colorList) {
+    key.push_back(char(color));
+  }
+  return key;
+}
+
+void CachedGraph::invalidateFoundAnswers() {
+  stats_.invalidations += foundColorLists_.size() + connectedNodes_.size();
+  foundColorLists_.clear();
+  connectedNodes_.clear();
+}
+
+void CachedGraph::invalidateReachableNodes(NodeId nodeId) {
+  for (auto it = reachableNodesBySource_.begin();
+       it != reachableNodesBySource_.end();) {
+    const auto& [reachableSource, reachableNodes] = *it;
+    if (reachableSource == nodeId || reachableNodes.count(nodeId)) {
+      it = reachableNodesBySource_.erase(it);
+      stats_.invalidations++;
+    } else {
+      ++it;
+    }
+  }
+}
+
+auto CachedGraph::findReachableNodes(NodeId source) const -> Graph::NodeIds {
+  auto reachableNodes = Graph::NodeIds();
+  auto stack = std::vector<NodeId>{source};
+  while (!stack.empty()) {
+    auto nodeId = stack.back();
+    stack.pop_back();
+    for (auto nextNodeId : graph_.findNodesBySource(nodeId)) {
+      if (reachableNodes.insert(nextNodeId).second) {
+        stack.push_back(nextNodeId);
+      }
+    }
+  }
+  return reachableNodes;
+}
+
+}  // namespace graph
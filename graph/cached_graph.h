@@ -0,0 +1,68 @@
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+#include "are_connected.h"
+#include "graph.h"
+#include "has_path.h"
+
+namespace graph {
+
+class CachedGraph {
+ public:
+  using NodeId = Graph::NodeId;
+
+  struct Stats {
+    std::size_t hits{};
+    std::size_t misses{};
+    std::size_t invalidations{};
+  };
+
+  CachedGraph() = default;
+  explicit CachedGraph(Graph graph) : graph_(std::move(graph)) {}
+
+  auto addNode(Color color) -> NodeId;
+  void addEdge(NodeId source, NodeId destination, Graph::Weight weight = 1);
+  void removeEdge(NodeId source, NodeId destination);
+  void removeNode(NodeId nodeId);
+  // Renumbers the nodes like Graph::compact: callers must translate every
+  // NodeId they hold through the returned old -> new mapping.
+  auto compact() -> Graph::NodeList;
+  bool needsCompaction() const { return graph_.needsCompaction(); }
+
+  bool hasPath(const ColorList &colorList);
+  bool areConnected(NodeId source, NodeId destination);
+
+  auto graph() const -> const Graph & { return graph_; }
+  auto stats() const -> const Stats & { return stats_; }
+
+ private:
+  struct NodePairHash {
+    auto operator()(const std::pair<NodeId, NodeId> &nodePair) const
+        -> std::size_t;
+  };
+
+  using ColorListKey = std::string;
+  using NodePairs = std::unordered_set<std::pair<NodeId, NodeId>, NodePairHash>;
+
+  Graph graph_{};
+  Stats stats_{};
+
+  NodePairs connectedNodes_{};
+  std::unordered_map<NodeId, Graph::NodeIds> reachableNodesBySource_{};
+  std::unordered_set<ColorListKey> foundColorLists_{};
+  std::unordered_set<ColorListKey> missingColorLists_{};
+
+  AreConnectedScratch areConnectedScratch_{};
+  HasPathScratch hasPathScratch_{};
+
+  static auto makeKey(const ColorList &colorList) -> ColorListKey;
+  void invalidateFoundAnswers();
+  void invalidateReachableNodes(NodeId nodeId);
+  auto findReachableNodes(NodeId source) const -> Graph::NodeIds;
+};
+
+}  // namespace graph
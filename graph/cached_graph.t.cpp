@@ -0,0 +1,174 @@
+
+#include <gtest/gtest.h>
+
+#include "cached_graph.h"
+#include "graph_generators.h"
+
+namespace graph {
+
+using NodeId = Graph::NodeId;
+
+// --- TestCachedGraph ---
+
+class TestCachedGraph : public ::testing::TestWithParam<std::size_t> {};
+
+INSTANTIATE_TEST_SUITE_P(TestCachedGraph, TestCachedGraph,
+                         ::testing::Values(10, 100, 1'000));
+
+TEST_P(TestCachedGraph, testMatchesUncachedQueries) {
+  constexpr auto NUM_ROUNDS = 20;
+  constexpr auto QUERIES_PER_ROUND = 50;
+
+  auto numNodes = GetParam();
+  auto randomGenerator = RandomGenerator(4242);
+  auto cachedGraph =
+      CachedGraph(createRandomGraph(numNodes, numNodes / 2, &randomGenerator));
+
+  auto numQueries = std::size_t();
+  for (auto round = 0; round < NUM_ROUNDS; round++) {
+    for (auto i = 0; i < QUERIES_PER_ROUND; i++) {
+      auto source = NodeId(randomGenerator() % (numNodes / 5 + 1));
+      auto destination = NodeId(randomGenerator() % numNodes);
+      EXPECT_EQ(areConnected(cachedGraph.graph(), source, destination),
+                cachedGraph.areConnected(source, destination))
+          << source << " -> " << destination;
+
+      auto colorList = createRandomColorList(1 + i % 3, &randomGenerator);
+      EXPECT_EQ(graph::hasPath(cachedGraph.graph(), colorList),
+                cachedGraph.hasPath(colorList))
+          << toString(colorList);
+      numQueries += 2;
+    }
+
+    cachedGraph.addEdge(randomGenerator() % numNodes,
+                        randomGenerator() % numNodes);
+    if (round % 5 == 0) {
+      cachedGraph.addNode(Color::White);
+      numNodes++;
+    }
+  }
+
+  const auto &stats = cachedGraph.stats();
+  EXPECT_EQ(numQueries, stats.hits + stats.misses);
+  EXPECT_GT(stats.hits, 0);
+}
+
+TEST_P(TestCachedGraph, testMatchesUncachedQueriesAfterRemovals) {
+  constexpr auto NUM_ROUNDS = 20;
+  constexpr auto QUERIES_PER_ROUND = 50;
+
+  auto numNodes = GetParam();
+  auto randomGenerator = RandomGenerator(4242);
+  auto cachedGraph =
+      CachedGraph(createRandomGraph(numNodes, 2 * numNodes, &randomGenerator));
+
+  for (auto round = 0; round < NUM_ROUNDS; round++) {
+    for (auto i = 0; i < QUERIES_PER_ROUND; i++) {
+      auto source = NodeId(randomGenerator() % numNodes);
+      auto destination = NodeId(randomGenerator() % numNodes);
+      EXPECT_EQ(areConnected(cachedGraph.graph(), source, destination),
+                cachedGraph.areConnected(source, destination))
+          << source << " -> " << destination;
+
+      auto colorList = createRandomColorList(1 + i % 3, &randomGenerator);
+      EXPECT_EQ(graph::hasPath(cachedGraph.graph(), colorList),
+                cachedGraph.hasPath(colorList))
+          << toString(colorList);
+    }
+
+    auto source = NodeId(randomGenerator() % numNodes);
+    if (!cachedGraph.graph().hasNode(source)) {
+      continue;
+    }
+    const auto &destinations = cachedGraph.graph().findNodesBySource(source);
+    if (!destinations.empty()) {
+      cachedGraph.removeEdge(source, *destinations.begin());
+    }
+    if (round % 5 == 0) {
+      cachedGraph.removeNode(source);
+    }
+    if (cachedGraph.needsCompaction()) {
+      cachedGraph.compact();
+      numNodes = cachedGraph.graph().numNodes();
+      ASSERT_EQ(0, cachedGraph.graph().numRemovedNodes());
+      if (numNodes == 0) {
+        break;
+      }
+    }
+  }
+}
+
+// --- TestCachedGraph_Invalidation ---
+
+TEST(TestCachedGraph_Invalidation, testKeepsUnaffectedAnswers) {
+  auto cachedGraph = CachedGraph();
+  auto a = cachedGraph.addNode(Color::Red);
+  auto b = cachedGraph.addNode(Color::Green);
+  auto c = cachedGraph.addNode(Color::Blue);
+  auto d = cachedGraph.addNode(Color::Yellow);
+  cachedGraph.addEdge(a, b);
+
+  EXPECT_TRUE(cachedGraph.areConnected(a, b));
+  EXPECT_FALSE(cachedGraph.areConnected(a, c));
+  EXPECT_FALSE(cachedGraph.areConnected(c, d));
+  EXPECT_EQ(3, cachedGraph.stats().misses);
+
+  cachedGraph.addEdge(c, d);
+  EXPECT_TRUE(cachedGraph.areConnected(a, b));
+  EXPECT_FALSE(cachedGraph.areConnected(a, d));
+  EXPECT_EQ(2, cachedGraph.stats().hits);
+  EXPECT_EQ(1, cachedGraph.stats().invalidations);
+
+  EXPECT_TRUE(cachedGraph.areConnected(c, d));
+  EXPECT_EQ(4, cachedGraph.stats().misses);
+
+  cachedGraph.addEdge(b, c);
+  EXPECT_TRUE(cachedGraph.areConnected(a, d));
+  EXPECT_EQ(5, cachedGraph.stats().misses);
+}
+
+TEST(TestCachedGraph_Invalidation, testCompactRemapsAnswers) {
+  auto cachedGraph = CachedGraph();
+  auto a = cachedGraph.addNode(Color::Red);
+  auto b = cachedGraph.addNode(Color::Green);
+  auto c = cachedGraph.addNode(Color::Blue);
+  auto d = cachedGraph.addNode(Color::Yellow);
+  cachedGraph.addEdge(b, c);
+  cachedGraph.addEdge(c, d);
+  cachedGraph.removeNode(a);
+  ASSERT_TRUE(cachedGraph.needsCompaction());
+
+  EXPECT_TRUE(cachedGraph.areConnected(b, d));
+  EXPECT_FALSE(cachedGraph.areConnected(d, b));
+  EXPECT_TRUE(cachedGraph.hasPath(ColorList{Color::Green, Color::Yellow}));
+  EXPECT_EQ(3, cachedGraph.stats().misses);
+
+  auto newNodeIds = cachedGraph.compact();
+  EXPECT_FALSE(cachedGraph.needsCompaction());
+  EXPECT_EQ(Graph::NO_NODE_ID, newNodeIds[a]);
+  EXPECT_TRUE(cachedGraph.areConnected(newNodeIds[b], newNodeIds[d]));
+  EXPECT_FALSE(cachedGraph.areConnected(newNodeIds[d], newNodeIds[b]));
+  EXPECT_TRUE(cachedGraph.hasPath(ColorList{Color::Green, Color::Yellow}));
+  EXPECT_EQ(3, cachedGraph.stats().hits);
+  EXPECT_EQ(3, cachedGraph.stats().misses);
+}
+
+TEST(TestCachedGraph_Invalidation, testColorListsAfterNewNode) {
+  auto cachedGraph = CachedGraph();
+  auto a = cachedGraph.addNode(Color::Red);
+
+  EXPECT_FALSE(cachedGraph.hasPath(ColorList{Color::Blue}));
+  EXPECT_FALSE(cachedGraph.hasPath(ColorList{Color::Red, Color::Blue}));
+
+  auto b = cachedGraph.addNode(Color::Blue);
+  EXPECT_TRUE(cachedGraph.hasPath(ColorList{Color::Blue}));
+  EXPECT_FALSE(cachedGraph.hasPath(ColorList{Color::Red, Color::Blue}));
+  EXPECT_EQ(1, cachedGraph.stats().hits);
+
+  cachedGraph.addEdge(a, b);
+  EXPECT_TRUE(cachedGraph.hasPath(ColorList{Color::Red, Color::Blue}));
+  EXPECT_TRUE(cachedGraph.hasPath(ColorList{Color::Blue}));
+  EXPECT_EQ(2, cachedGraph.stats().hits);
+}
+
+}  // namespace graph
@@ -1,28 +1,71 @@
 #include "color.h"
 
+#include <algorithm>
 #include <stdexcept>
+#include <utility>
 
 namespace graph {
 
+ColorList::ColorList(std::initializer_list<Color> colors) {
+  for (auto color : colors) {
+    push_back(color);
+  }
+}
+
+ColorList::ColorList(ColorList&& other) noexcept
+    : size_(other.size_),
+      inlineColors_(other.inlineColors_),
+      heapColors_(std::move(other.heapColors_)) {
+  other.clear();
+}
+
+auto ColorList::operator=(ColorList&& other) noexcept -> ColorList& {
+  if (this != &other) {
+    size_ = other.size_;
+    inlineColors_ = other.inlineColors_;
+    heapColors_ = std::move(other.heapColors_);
+    other.clear();
+  }
+  return *this;
+}
+
+void ColorList::push_back(Color color) {
+  if (size_ < INLINE_CAPACITY) {
+    inlineColors_[size_++] = color;
+    return;
+  }
+  if (size_ == INLINE_CAPACITY) {
+    heapColors_.assign(inlineColors_.begin(), inlineColors_.end());
+  }
+  heapColors_.push_back(color);
+  size_++;
+}
+
+void ColorList::pop_back() {
+  size_--;
+  if (size_ >= INLINE_CAPACITY) {
+    heapColors_.pop_back();
+  }
+  if (size_ == INLINE_CAPACITY) {
+    std::copy(heapColors_.begin(), heapColors_.end(), inlineColors_.begin());
+    heapColors_.clear();
+  }
+}
+
+void ColorList::clear() {
+  size_ = 0;
+  heapColors_.clear();
+}
+
+bool ColorList::operator==(const ColorList& other) const {
+  return std::equal(begin(), end(), other.begin(), other.end());
+}
+
 auto toString(Color color) -> std::string {
-  switch (color) {
-    case Color::Black:
-      return "Black";
-    case Color::Blue:
-      return "Blue";
-    case Color::Green:
-      return "Green";
-    case Color::Orange:
-      return "Orange";
-    case Color::Red:
-      return "Red";
-    case Color::Yellow:
-      return "Yellow";
-    case Color::White:
-      return "White";
-  }
-
-  throw std::runtime_error("Invalid color");
+  if (std::size_t(color) >= NUM_COLORS) {
+    throw std::runtime_error("Invalid color");
+  }
+  return std::string(COLOR_NAMES[std::size_t(color)]);
 }
 
 auto toString(const ColorList& colorList) -> std::string {
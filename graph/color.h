@@ -1,12 +1,75 @@
 #pragma once
 
+#include <array>
+#include <cstdint>
+#include <initializer_list>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace graph {
 
-enum class Color { Black, Blue, Green, Orange, Red, Yellow, White };
-using ColorList = std::vector<Color>;
+enum class Color : std::uint8_t {
+  Black,
+  Blue,
+  Green,
+  Orange,
+  Red,
+  Yellow,
+  White
+};
+constexpr auto NUM_COLORS = std::size_t(Color::White) + 1;
+
+constexpr auto COLOR_NAMES = std::array<std::string_view, NUM_COLORS>{
+    "Black", "Blue", "Green", "Orange", "Red", "Yellow", "White"};
+
+class ColorList {
+ public:
+  using value_type = Color;
+  using size_type = std::size_t;
+  using iterator = Color *;
+  using const_iterator = const Color *;
+
+  ColorList() = default;
+  ColorList(std::initializer_list<Color> colors);
+  ColorList(const ColorList &) = default;
+  ColorList(ColorList &&other) noexcept;
+  auto operator=(const ColorList &) -> ColorList & = default;
+  auto operator=(ColorList &&other) noexcept -> ColorList &;
+
+  auto size() const -> std::size_t { return size_; }
+  bool empty() const { return size_ == 0; }
+
+  auto data() -> Color * {
+    return size_ <= INLINE_CAPACITY ? inlineColors_.data() : heapColors_.data();
+  }
+  auto data() const -> const Color * {
+    return size_ <= INLINE_CAPACITY ? inlineColors_.data() : heapColors_.data();
+  }
+  auto begin() -> iterator { return data(); }
+  auto end() -> iterator { return data() + size_; }
+  auto begin() const -> const_iterator { return data(); }
+  auto end() const -> const_iterator { return data() + size_; }
+
+  auto operator[](std::size_t index) -> Color & { return data()[index]; }
+  auto operator[](std::size_t index) const -> Color { return data()[index]; }
+  auto front() const -> Color { return data()[0]; }
+  auto back() const -> Color { return data()[size_ - 1]; }
+
+  void push_back(Color color);
+  void pop_back();
+  void clear();
+
+  bool operator==(const ColorList &other) const;
+  bool operator!=(const ColorList &other) const { return !(*this == other); }
+
+ private:
+  static constexpr auto INLINE_CAPACITY = std::size_t(16);
+
+  std::size_t size_{};
+  std::array<Color, INLINE_CAPACITY> inlineColors_{};
+  std::vector<Color> heapColors_{};
+};
 
 auto toString(Color color) -> std::string;
 auto toString(const ColorList& colorList) -> std::string;
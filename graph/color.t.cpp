@@ -0,0 +1,74 @@
+#include <gtest/gtest.h>
+
+#include "color.h"
+
+namespace graph {
+
+TEST(TestColor, testToString) {
+  EXPECT_EQ("Black", toString(Color::Black));
+  EXPECT_EQ("White", toString(Color::White));
+  EXPECT_EQ("Red_Green", toString(ColorList{Color::Red, Color::Green}));
+  EXPECT_EQ("", toString(ColorList{}));
+  EXPECT_THROW(toString(Color(NUM_COLORS)), std::runtime_error);
+}
+
+// --- TestColorList ---
+
+class TestColorList : public ::testing::TestWithParam<std::size_t> {};
+
+INSTANTIATE_TEST_SUITE_P(TestColorList, TestColorList,
+                         ::testing::Values(0, 1, 15, 16, 17, 100));
+
+TEST_P(TestColorList, testPushAndPop) {
+  auto size = GetParam();
+
+  auto colorList = ColorList();
+  auto expectedColors = std::vector<Color>();
+  for (auto i = std::size_t(); i < size; i++) {
+    colorList.push_back(Color(i % NUM_COLORS));
+    expectedColors.push_back(Color(i % NUM_COLORS));
+  }
+  ASSERT_EQ(size, colorList.size());
+  EXPECT_EQ(size == 0, colorList.empty());
+  EXPECT_EQ(expectedColors,
+            std::vector<Color>(colorList.begin(), colorList.end()));
+
+  auto copiedList = colorList;
+  EXPECT_EQ(colorList, copiedList);
+  if (size > 0) {
+    copiedList[size - 1] = Color::White;
+    EXPECT_EQ(Color::White, copiedList.back());
+  }
+
+  while (!colorList.empty()) {
+    colorList.pop_back();
+    expectedColors.pop_back();
+    EXPECT_EQ(expectedColors,
+              std::vector<Color>(colorList.begin(), colorList.end()));
+  }
+}
+
+TEST_P(TestColorList, testMove) {
+  auto size = GetParam();
+
+  auto colorList = ColorList();
+  for (auto i = std::size_t(); i < size; i++) {
+    colorList.push_back(Color(i % NUM_COLORS));
+  }
+  auto expectedList = colorList;
+
+  auto movedList = std::move(colorList);
+  EXPECT_EQ(expectedList, movedList);
+  EXPECT_TRUE(colorList.empty());
+  EXPECT_EQ(colorList.begin(), colorList.end());
+
+  colorList.push_back(Color::Red);
+  EXPECT_EQ(ColorList{Color::Red}, colorList);
+
+  colorList = std::move(movedList);
+  EXPECT_EQ(expectedList, colorList);
+  EXPECT_TRUE(movedList.empty());
+  EXPECT_EQ(movedList.begin(), movedList.end());
+}
+
+}  // namespace graph
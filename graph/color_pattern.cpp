@@ -0,0 +1,295 @@
+#include "color_pattern.h"
+
+#include <algorithm>
+#include <bitset>
+#include <cctype>
+#include <limits>
+#include <map>
+#include <stdexcept>
+#include <string>
+
+namespace graph {
+namespace {
+
+constexpr auto MAX_DFA_STATES = std::size_t(4'096);
+
+using StateId = ColorPattern::StateId;
+using ColorMask = std::bitset<NUM_COLORS>;
+using NfaStateId = std::size_t;
+using NfaStateIds = std::vector<NfaStateId>;
+using Transitions = std::array<StateId, NUM_COLORS>;
+
+constexpr auto NO_NFA_STATE = std::numeric_limits<NfaStateId>::max();
+
+struct NfaState {
+  ColorMask colors{};
+  NfaStateId next{NO_NFA_STATE};
+  NfaStateIds epsilons{};
+};
+
+struct Nfa {
+  std::vector<NfaState> states{};
+  NfaStateId start{};
+  NfaStateId accept{};
+};
+
+struct Fragment {
+  NfaStateId start{};
+  NfaStateId end{};
+};
+
+class PatternParser {
+ public:
+  explicit PatternParser(std::string_view pattern) : pattern_(pattern) {}
+
+  auto parse() -> Nfa;
+
+ private:
+  std::string_view pattern_{};
+  std::size_t position_{};
+  std::vector<NfaState> states_{};
+
+  auto parseAlternation() -> Fragment;
+  auto parseConcatenation() -> Fragment;
+  auto parseRepetition() -> Fragment;
+  auto parseAtom() -> Fragment;
+  auto parseColor() -> Color;
+
+  auto peek() -> char;
+  auto addState() -> NfaStateId;
+  auto makeEmpty() -> Fragment;
+  [[noreturn]] void fail(const std::string &reason) const;
+};
+
+auto PatternParser::parse() -> Nfa {
+  auto fragment = parseAlternation();
+  if (peek() != '\0') {
+    fail("unexpected '" + std::string(1, peek()) + "'");
+  }
+  return {std::move(states_), fragment.start, fragment.end};
+}
+
+auto PatternParser::parseAlternation() -> Fragment {
+  auto fragment = parseConcatenation();
+  while (peek() == '|') {
+    position_++;
+    auto alternative = parseConcatenation();
+    auto start = addState();
+    auto end = addState();
+    states_[start].epsilons = {fragment.start, alternative.start};
+    states_[fragment.end].epsilons.push_back(end);
+    states_[alternative.end].epsilons.push_back(end);
+    fragment = {start, end};
+  }
+  return fragment;
+}
+
+auto PatternParser::parseConcatenation() -> Fragment {
+  auto fragment = makeEmpty();
+  while (peek() != '\0' && peek() != '|' && peek() != ')') {
+    auto next = parseRepetition();
+    states_[fragment.end].epsilons.push_back(next.start);
+    fragment.end = next.end;
+  }
+  return fragment;
+}
+
+auto PatternParser::parseRepetition() -> Fragment {
+  auto fragment = parseAtom();
+  while (peek() == '*' || peek() == '+' || peek() == '?') {
+    auto op = pattern_[position_++];
+    auto start = addState();
+    auto end = addState();
+    states_[start].epsilons.push_back(fragment.start);
+    states_[fragment.end].epsilons.push_back(end);
+    if (op != '+') {
+      states_[start].epsilons.push_back(end);
+    }
+    if (op != '?') {
+      states_[fragment.end].epsilons.push_back(fragment.start);
+    }
+    fragment = {start, end};
+  }
+  return fragment;
+}
+
+auto PatternParser::parseAtom() -> Fragment {
+  auto symbol = peek();
+  if (symbol == '(') {
+    position_++;
+    auto fragment = parseAlternation();
+    if (peek() != ')') {
+      fail("missing ')'");
+    }
+    position_++;
+    return fragment;
+  }
+
+  auto colors = ColorMask();
+  if (symbol == '.') {
+    position_++;
+    colors.set();
+  } else if (std::isalpha(static_cast<unsigned char>(symbol))) {
+    colors.set(std::size_t(parseColor()));
+  } else {
+    fail(symbol == '\0' ? "unexpected end"
+                        : "unexpected '" + std::string(1, symbol) + "'");
+  }
+
+  auto start = addState();
+  auto end = addState();
+  states_[start].colors = colors;
+  states_[start].next = end;
+  return {start, end};
+}
+
+auto PatternParser::parseColor() -> Color {
+  auto first = position_;
+  while (position_ < pattern_.size() &&
+         std::isalpha(static_cast<unsigned char>(pattern_[position_]))) {
+    position_++;
+  }
+  auto name = pattern_.substr(first, position_ - first);
+  auto nameIt = std::find(COLOR_NAMES.begin(), COLOR_NAMES.end(), name);
+  if (nameIt == COLOR_NAMES.end()) {
+    fail("unknown color '" + std::string(name) + "'");
+  }
+  return Color(nameIt - COLOR_NAMES.begin());
+}
+
+auto PatternParser::peek() -> char {
+  while (position_ < pattern_.size() &&
+         std::isspace(static_cast<unsigned char>(pattern_[position_]))) {
+    position_++;
+  }
+  return position_ < pattern_.size() ? pattern_[position_] : '\0';
+}
+
+auto PatternParser::addState() -> NfaStateId {
+  states_.emplace_back();
+  return states_.size() - 1;
+}
+
+auto PatternParser::makeEmpty() -> Fragment {
+  auto state = addState();
+  return {state, state};
+}
+
+void PatternParser::fail(const std::string& reason) const {
+  throw std::runtime_error("Invalid color pattern \"" + std::string(pattern_) +
+                           "\": " + reason);
+}
+
+auto findClosure(const Nfa& nfa, NfaStateIds stateIds) -> NfaStateIds {
+  auto isReached = std::vector<bool>(nfa.states.size());
+  for (auto stateId : stateIds) {
+    isReached[stateId] = true;
+  }
+  for (auto i = std::size_t(); i < stateIds.size(); i++) {
+    for (auto nextStateId : nfa.states[stateIds[i]].epsilons) {
+      if (!isReached[nextStateId]) {
+        isReached[nextStateId] = true;
+        stateIds.push_back(nextStateId);
+      }
+    }
+  }
+  std::sort(stateIds.begin(), stateIds.end());
+  stateIds.erase(std::unique(stateIds.begin(), stateIds.end()),
+                 stateIds.end());
+  return stateIds;
+}
+
+auto findLiveStates(const std::vector<Transitions>& transitions,
+                    const std::vector<bool>& accepting) -> std::vector<bool> {
+  auto isLive = accepting;
+  for (auto changed = true; changed;) {
+    changed = false;
+    for (auto state = std::size_t(); state < transitions.size(); state++) {
+      if (isLive[state]) continue;
+      for (auto nextState : transitions[state]) {
+        if (isLive[nextState]) {
+          isLive[state] = true;
+          changed = true;
+          break;
+        }
+      }
+    }
+  }
+  return isLive;
+}
+
+}  // namespace
+
+auto ColorPattern::compile(std::string_view pattern) -> ColorPattern {
+  auto nfa = PatternParser(pattern).parse();
+
+  auto transitions = std::vector<Transitions>{Transitions()};
+  auto accepting = std::vector<bool>{false};
+  auto stateSets = std::vector<NfaStateIds>{NfaStateIds()};
+  auto stateIds = std::map<NfaStateIds, StateId>{{NfaStateIds(), DEAD_STATE}};
+  auto findState = [&](NfaStateIds stateSet) -> StateId {
+    auto [stateIt, inserted] =
+        stateIds.emplace(std::move(stateSet), StateId(stateSets.size()));
+    if (inserted) {
+      if (stateSets.size() == MAX_DFA_STATES) {
+        throw std::runtime_error("Invalid color pattern \"" +
+                                 std::string(pattern) + "\": too complex");
+      }
+      stateSets.push_back(stateIt->first);
+      transitions.emplace_back();
+      accepting.push_back(std::binary_search(
+          stateIt->first.begin(), stateIt->first.end(), nfa.accept));
+    }
+    return stateIt->second;
+  };
+  findState(findClosure(nfa, {nfa.start}));
+
+  for (auto state = START_STATE; state < stateSets.size(); state++) {
+    for (auto colorIndex = std::size_t(); colorIndex < NUM_COLORS;
+         colorIndex++) {
+      auto nextStateSet = NfaStateIds();
+      for (auto nfaStateId : stateSets[state]) {
+        const auto& nfaState = nfa.states[nfaStateId];
+        if (nfaState.colors.test(colorIndex)) {
+          nextStateSet.push_back(nfaState.next);
+        }
+      }
+      auto nextState = findState(findClosure(nfa, std::move(nextStateSet)));
+      transitions[state][colorIndex] = nextState;
+    }
+  }
+
+  auto isLive = findLiveStates(transitions, accepting);
+  auto newStateIds = std::vector<StateId>(transitions.size(), DEAD_STATE);
+  auto colorPattern = ColorPattern();
+  for (auto state = START_STATE; state < transitions.size(); state++) {
+    if (state == START_STATE || isLive[state]) {
+      newStateIds[state] = StateId(colorPattern.accepting_.size() + 1);
+      colorPattern.accepting_.push_back(accepting[state]);
+    }
+  }
+  colorPattern.accepting_.insert(colorPattern.accepting_.begin(), false);
+  colorPattern.transitions_.resize(colorPattern.accepting_.size());
+  for (auto state = START_STATE; state < transitions.size(); state++) {
+    if (newStateIds[state] == DEAD_STATE) continue;
+    auto& newTransitions = colorPattern.transitions_[newStateIds[state]];
+    for (auto colorIndex = std::size_t(); colorIndex < NUM_COLORS;
+         colorIndex++) {
+      newTransitions[colorIndex] = newStateIds[transitions[state][colorIndex]];
+    }
+  }
+  return colorPattern;
+}
+
+auto ColorPattern::fromColorList(const ColorList& colorList) -> ColorPattern {
+  auto pattern = std::string();
+  auto separator = "";
+  for (auto color : colorList) {
+    pattern.append(separator);
+    pattern.append(toString(color));
+    separator = " .* ";
+  }
+  return compile(pattern);
+}
+
+}  // namespace graph
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include "color.h"
+
+namespace graph {
+
+class ColorPattern {
+ public:
+  using StateId = std::uint32_t;
+
+  static constexpr auto DEAD_STATE = StateId(0);
+  static constexpr auto START_STATE = StateId(1);
+
+  static auto compile(std::string_view pattern) -> ColorPattern;
+  static auto fromColorList(const ColorList &colorList) -> ColorPattern;
+
+  auto numStates() const -> std::size_t { return transitions_.size(); }
+  auto nextState(StateId state, Color color) const -> StateId {
+    return transitions_[state][std::size_t(color)];
+  }
+  bool isAccepting(StateId state) const { return accepting_[state]; }
+
+ private:
+  std::vector<std::array<StateId, NUM_COLORS>> transitions_{};
+  std::vector<bool> accepting_{};
+};
+
+}  // namespace graph
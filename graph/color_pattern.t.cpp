@@ -0,0 +1,131 @@
+#include <gtest/gtest.h>
+
+#include "color_pattern.h"
+#include "graph_generators.h"
+#include "has_path.h"
+
+namespace graph {
+namespace {
+
+bool isMatching(const ColorPattern &colorPattern,
+                const std::vector<Color> &colors) {
+  auto stateId = ColorPattern::START_STATE;
+  for (auto color : colors) {
+    stateId = colorPattern.nextState(stateId, color);
+  }
+  return colorPattern.isAccepting(stateId);
+}
+
+auto createChain(const std::vector<Color> &colors) -> Graph {
+  auto graph = Graph();
+  for (auto color : colors) {
+    auto nodeId = graph.addNode(color);
+    if (nodeId > 0) {
+      graph.addEdge(nodeId - 1, nodeId);
+    }
+  }
+  return graph;
+}
+
+}  // namespace
+
+TEST(TestColorPattern, testCompile) {
+  auto colorPattern = ColorPattern::compile("Red (Blue|Green)+ White");
+  EXPECT_TRUE(
+      isMatching(colorPattern, {Color::Red, Color::Blue, Color::White}));
+  EXPECT_TRUE(isMatching(colorPattern, {Color::Red, Color::Green, Color::Blue,
+                                        Color::Green, Color::White}));
+  EXPECT_FALSE(isMatching(colorPattern, {Color::Red, Color::White}));
+  EXPECT_FALSE(isMatching(colorPattern, {Color::Red, Color::Blue}));
+  EXPECT_FALSE(
+      isMatching(colorPattern, {Color::Red, Color::Black, Color::White}));
+
+  EXPECT_TRUE(isMatching(ColorPattern::compile("Red .* White"),
+                         {Color::Red, Color::Black, Color::White}));
+  EXPECT_TRUE(isMatching(ColorPattern::compile("Red .* White"),
+                         {Color::Red, Color::White}));
+  EXPECT_TRUE(isMatching(ColorPattern::compile("Red Blue? White"),
+                         {Color::Red, Color::White}));
+  EXPECT_FALSE(isMatching(ColorPattern::compile("Red Blue? White"),
+                          {Color::Red, Color::Blue, Color::Blue,
+                           Color::White}));
+  EXPECT_TRUE(isMatching(ColorPattern::compile("(Red Blue)*"), {}));
+  EXPECT_FALSE(isMatching(ColorPattern::compile("(Red Blue)*"), {Color::Red}));
+}
+
+TEST(TestColorPattern, testDeadStates) {
+  auto colorPattern = ColorPattern::compile("Red");
+  EXPECT_EQ(3, colorPattern.numStates());
+  EXPECT_EQ(ColorPattern::DEAD_STATE,
+            colorPattern.nextState(ColorPattern::START_STATE, Color::Blue));
+  EXPECT_EQ(ColorPattern::DEAD_STATE,
+            colorPattern.nextState(
+                colorPattern.nextState(ColorPattern::START_STATE, Color::Red),
+                Color::Red));
+}
+
+TEST(TestColorPattern, testInvalidPatterns) {
+  EXPECT_THROW(ColorPattern::compile("Red (Blue"), std::runtime_error);
+  EXPECT_THROW(ColorPattern::compile("Red Blue)"), std::runtime_error);
+  EXPECT_THROW(ColorPattern::compile("Purple"), std::runtime_error);
+  EXPECT_THROW(ColorPattern::compile("*Red"), std::runtime_error);
+  EXPECT_THROW(ColorPattern::compile("Red & Blue"), std::runtime_error);
+}
+
+TEST(TestColorPattern, testHasPath) {
+  auto graph = createChain(
+      {Color::Red, Color::Blue, Color::Green, Color::Blue, Color::White});
+  auto frozenGraph = graph.freeze();
+
+  auto expectations = std::vector<std::pair<std::string, bool>>{
+      {"Red (Blue|Green)+ White", true},
+      {"Red Blue White", false},
+      {"Red . . . White", true},
+      {"Red .? White", false},
+      {"Blue Green", true},
+      {"Green Red", false},
+      {"Orange", false},
+      {"White", true},
+      {"", false},
+  };
+  auto scratch = HasPathScratch();
+  for (const auto &[pattern, expected] : expectations) {
+    auto colorPattern = ColorPattern::compile(pattern);
+    EXPECT_EQ(expected, hasPath(graph, colorPattern)) << pattern;
+    EXPECT_EQ(expected, hasPath(frozenGraph, colorPattern, &scratch))
+        << pattern;
+  }
+}
+
+// --- TestColorPatternFromColorList ---
+
+class TestColorPatternFromColorList
+    : public ::testing::TestWithParam<std::size_t> {};
+
+INSTANTIATE_TEST_SUITE_P(TestColorPatternFromColorList,
+                         TestColorPatternFromColorList,
+                         ::testing::Values(1, 10, 100, 1'000));
+
+TEST_P(TestColorPatternFromColorList, testSameAsColorList) {
+  constexpr auto NUM_COLOR_LISTS = 100;
+  constexpr auto MAX_COLOR_LIST_SIZE = 5;
+
+  auto numNodes = GetParam();
+  auto randomGenerator = RandomGenerator(4242);
+  auto graph = createRandomGraph(numNodes, 2 * numNodes, &randomGenerator);
+  auto frozenGraph = graph.freeze();
+
+  auto scratch = HasPathScratch();
+  for (auto i = 0; i < NUM_COLOR_LISTS; i++) {
+    auto colorList =
+        createRandomColorList(i % (MAX_COLOR_LIST_SIZE + 1), &randomGenerator);
+    auto colorPattern = ColorPattern::fromColorList(colorList);
+    auto expected = hasPath(graph, colorList);
+    EXPECT_EQ(expected, hasPath(graph, colorPattern, &scratch))
+        << "colorList: " << toString(colorList);
+    EXPECT_EQ(expected, hasPath(frozenGraph, colorPattern, &scratch))
+        << "colorList: " << toString(colorList);
+  }
+}
+
+}  // namespace graph
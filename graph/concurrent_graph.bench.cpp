@@ -0,0 +1,83 @@
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <future>
+
+#include "are_connected.h"
+#include "concurrent_graph.h"
+#include "graph_generators.h"
+
+namespace {
+
+constexpr auto NUM_NODES = std::size_t(100'000);
+constexpr auto EDGES_PER_NODE = std::size_t(2);
+constexpr auto QUERIES_PER_READER = std::size_t(64);
+
+auto createConcurrentGraph(graph::RandomGenerator *randomGenerator)
+    -> std::unique_ptr<graph::ConcurrentGraph> {
+  auto concurrentGraph = std::make_unique<graph::ConcurrentGraph>();
+  for (auto i = std::size_t(); i < NUM_NODES; i++) {
+    concurrentGraph->addNode(
+        graph::Color((*randomGenerator)() % graph::NUM_COLORS));
+  }
+  for (auto i = std::size_t(); i < NUM_NODES * EDGES_PER_NODE; i++) {
+    concurrentGraph->addEdge((*randomGenerator)() % NUM_NODES,
+                             (*randomGenerator)() % NUM_NODES);
+  }
+  return concurrentGraph;
+}
+
+template <bool WITH_WRITER>
+void BM_ConcurrentGraphReaders(benchmark::State &state) {
+  auto numReaders = unsigned(state.range(0));
+  auto randomGenerator = graph::RandomGenerator(4242);
+  auto concurrentGraph = createConcurrentGraph(&randomGenerator);
+
+  auto stop = std::atomic<bool>();
+  auto numWrites = std::atomic<std::size_t>();
+  auto writer = std::async(std::launch::async, [&]() {
+    auto writerGenerator = graph::RandomGenerator(1);
+    while (WITH_WRITER && !stop.load(std::memory_order_relaxed)) {
+      auto nodeId = concurrentGraph->addNode(graph::Color::Black);
+      concurrentGraph->addEdge(writerGenerator() % nodeId, nodeId);
+      concurrentGraph->addEdge(nodeId, writerGenerator() % nodeId);
+      numWrites.fetch_add(3, std::memory_order_relaxed);
+    }
+  });
+
+  for (auto _ : state) {
+    auto readers = std::vector<std::future<void>>();
+    for (auto reader = 0U; reader < numReaders; reader++) {
+      readers.emplace_back(std::async(std::launch::async, [&, reader]() {
+        auto readerGenerator = graph::RandomGenerator(reader);
+        auto scratch = graph::AreConnectedScratch();
+        for (auto i = std::size_t(); i < QUERIES_PER_READER; i++) {
+          auto snapshot = concurrentGraph->snapshot();
+          benchmark::DoNotOptimize(graph::areConnected(
+              snapshot, readerGenerator() % NUM_NODES,
+              readerGenerator() % NUM_NODES, &scratch));
+        }
+      }));
+    }
+    for (auto &reader : readers) {
+      reader.get();
+    }
+  }
+
+  stop.store(true);
+  writer.get();
+  state.SetItemsProcessed(std::int64_t(state.iterations()) * numReaders *
+                          QUERIES_PER_READER);
+  state.counters["writes"] = double(numWrites.load());
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_ConcurrentGraphReaders, false)
+    ->RangeMultiplier(2)
+    ->Range(1, 8)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ConcurrentGraphReaders, true)
+    ->RangeMultiplier(2)
+    ->Range(1, 8)
+    ->UseRealTime();
@@ -0,0 +1,184 @@
+#include "concurrent_graph.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace graph {
+namespace {
+
+constexpr auto FIRST_SEGMENT_SIZE = std::size_t(1'024);
+constexpr auto FIRST_BLOCK_CAPACITY = std::size_t(4);
+
+using NodeId = ConcurrentGraph::NodeId;
+using Version = ConcurrentGraph::Version;
+
+auto findHighestBit(std::uint64_t value) -> std::size_t {
+#ifdef _MSC_VER
+  auto bit = 0UL;
+  _BitScanReverse64(&bit, value);
+  return std::size_t(bit);
+#else
+  return std::size_t(63 - __builtin_clzll(value));
+#endif
+}
+
+auto findSegment(NodeId nodeId) -> std::size_t {
+  return findHighestBit(nodeId / FIRST_SEGMENT_SIZE + 1);
+}
+
+auto findSegmentBegin(std::size_t segment) -> NodeId {
+  return FIRST_SEGMENT_SIZE * ((std::size_t(1) << segment) - 1);
+}
+
+}  // namespace
+
+struct ConcurrentGraph::Block {
+  explicit Block(std::size_t capacity)
+      : capacity(capacity), entries(std::make_unique<Entry[]>(capacity)) {}
+
+  std::size_t capacity{};
+  std::atomic<std::size_t> size{};
+  std::unique_ptr<Entry[]> entries{};
+};
+
+struct ConcurrentGraph::Node {
+  Color color{};
+  Version version{};
+  std::atomic<Block*> nodesBySource{};
+  std::atomic<Block*> nodesByDestination{};
+};
+
+auto ConcurrentGraph::Snapshot::colorOf(NodeId nodeId) const -> Color {
+  return graph_->nodeAt(nodeId).color;
+}
+
+auto ConcurrentGraph::Snapshot::findNodesByColor(Color color) const
+    -> NodeRange {
+  return makeRange(graph_->nodesByColor_[std::size_t(color)], version_);
+}
+
+auto ConcurrentGraph::Snapshot::findNodesBySource(NodeId sourceNode) const
+    -> NodeRange {
+  if (sourceNode >= numNodes_) {
+    return {};
+  }
+  return makeRange(graph_->nodeAt(sourceNode).nodesBySource, version_);
+}
+
+auto ConcurrentGraph::Snapshot::findNodesByDestination(
+    NodeId destinationNode) const -> NodeRange {
+  if (destinationNode >= numNodes_) {
+    return {};
+  }
+  return makeRange(graph_->nodeAt(destinationNode).nodesByDestination,
+                   version_);
+}
+
+ConcurrentGraph::ConcurrentGraph() = default;
+
+ConcurrentGraph::~ConcurrentGraph() = default;
+
+auto ConcurrentGraph::addNode(Color color) -> NodeId {
+  if (std::size_t(color) >= NUM_COLORS) {
+    throw std::runtime_error("Invalid color");
+  }
+
+  auto nodeId = numNodes_.load(std::memory_order_relaxed);
+  auto segment = findSegment(nodeId);
+  if (!nodeSegments_[segment]) {
+    nodeSegments_[segment] =
+        std::make_unique<Node[]>(FIRST_SEGMENT_SIZE << segment);
+  }
+
+  auto version = version_.load(std::memory_order_relaxed) + 1;
+  auto& node = nodeAt(nodeId);
+  node.color = color;
+  node.version = version;
+  append(&nodesByColor_[std::size_t(color)], nodeId, version);
+
+  numNodes_.store(nodeId + 1, std::memory_order_release);
+  version_.store(version, std::memory_order_release);
+  return nodeId;
+}
+
+void ConcurrentGraph::addEdge(NodeId source, NodeId destination) {
+  auto numNodes = numNodes_.load(std::memory_order_relaxed);
+  if (source >= numNodes) {
+    throw std::runtime_error("Invalid source node id");
+  }
+  if (destination >= numNodes) {
+    throw std::runtime_error("Invalid destination node id");
+  }
+  if (!edges_.insert({source, destination}).second) {
+    return;
+  }
+
+  auto version = version_.load(std::memory_order_relaxed) + 1;
+  append(&nodeAt(source).nodesBySource, destination, version);
+  append(&nodeAt(destination).nodesByDestination, source, version);
+  version_.store(version, std::memory_order_release);
+}
+
+auto ConcurrentGraph::snapshot() const -> Snapshot {
+  auto version = version_.load(std::memory_order_acquire);
+  auto numNodes = numNodes_.load(std::memory_order_acquire);
+  while (numNodes > 0 && nodeAt(numNodes - 1).version > version) {
+    numNodes--;
+  }
+  return {this, version, numNodes};
+}
+
+auto ConcurrentGraph::EdgeHash::operator()(const Graph::Edge& edge) const
+    -> std::size_t {
+  auto hash = std::hash<NodeId>();
+  return hash(edge.first) * 31 + hash(edge.second);
+}
+
+auto ConcurrentGraph::nodeAt(NodeId nodeId) const -> Node& {
+  auto segment = findSegment(nodeId);
+  return nodeSegments_[segment][nodeId - findSegmentBegin(segment)];
+}
+
+void ConcurrentGraph::append(std::atomic<Block*>* block, NodeId nodeId,
+                             Version version) {
+  auto currentBlock = block->load(std::memory_order_relaxed);
+  auto size = currentBlock
+                  ? currentBlock->size.load(std::memory_order_relaxed)
+                  : std::size_t();
+  if (currentBlock && size < currentBlock->capacity) {
+    currentBlock->entries[size] = {nodeId, version};
+    currentBlock->size.store(size + 1, std::memory_order_release);
+    return;
+  }
+
+  auto capacity =
+      currentBlock ? 2 * currentBlock->capacity : FIRST_BLOCK_CAPACITY;
+  auto& nextBlock = blocks_.emplace_back(std::make_unique<Block>(capacity));
+  if (currentBlock) {
+    std::copy(currentBlock->entries.get(), currentBlock->entries.get() + size,
+              nextBlock->entries.get());
+  }
+  nextBlock->entries[size] = {nodeId, version};
+  nextBlock->size.store(size + 1, std::memory_order_relaxed);
+  block->store(nextBlock.get(), std::memory_order_release);
+}
+
+auto ConcurrentGraph::makeRange(const std::atomic<Block*>& block,
+                                Version version) -> NodeRange {
+  auto currentBlock = block.load(std::memory_order_acquire);
+  if (!currentBlock) {
+    return {};
+  }
+  auto entries = currentBlock->entries.get();
+  auto size = currentBlock->size.load(std::memory_order_acquire);
+  while (size > 0 && entries[size - 1].version > version) {
+    size--;
+  }
+  return {entries, entries + size};
+}
+
+}  // namespace graph
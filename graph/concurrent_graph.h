@@ -0,0 +1,127 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <unordered_set>
+#include <vector>
+
+#include "color.h"
+#include "graph.h"
+
+namespace graph {
+
+class ConcurrentGraph {
+ public:
+  using NodeId = Graph::NodeId;
+  using Version = std::uint64_t;
+
+ private:
+  struct Entry {
+    NodeId nodeId{};
+    Version version{};
+  };
+  struct Block;
+  struct Node;
+
+ public:
+  class NodeRange {
+   public:
+    class Iterator {
+     public:
+      using iterator_category = std::forward_iterator_tag;
+      using value_type = NodeId;
+      using difference_type = std::ptrdiff_t;
+      using pointer = const NodeId *;
+      using reference = const NodeId &;
+
+      explicit Iterator(const Entry *entry) : entry_(entry) {}
+
+      auto operator*() const -> const NodeId & { return entry_->nodeId; }
+      auto operator++() -> Iterator & {
+        ++entry_;
+        return *this;
+      }
+      bool operator==(const Iterator &other) const {
+        return entry_ == other.entry_;
+      }
+      bool operator!=(const Iterator &other) const {
+        return entry_ != other.entry_;
+      }
+
+     private:
+      const Entry *entry_{};
+    };
+
+    NodeRange() = default;
+    NodeRange(const Entry *begin, const Entry *end)
+        : begin_(begin), end_(end) {}
+
+    auto begin() const -> Iterator { return Iterator(begin_); }
+    auto end() const -> Iterator { return Iterator(end_); }
+    bool empty() const { return begin_ == end_; }
+    auto size() const -> std::size_t { return std::size_t(end_ - begin_); }
+
+   private:
+    const Entry *begin_{};
+    const Entry *end_{};
+  };
+
+  class Snapshot {
+   public:
+    auto version() const -> Version { return version_; }
+    auto numNodes() const -> std::size_t { return numNodes_; }
+    auto colorOf(NodeId nodeId) const -> Color;
+
+    auto findNodesByColor(Color color) const -> NodeRange;
+    auto findNodesBySource(NodeId sourceNode) const -> NodeRange;
+    auto findNodesByDestination(NodeId destinationNode) const -> NodeRange;
+
+   private:
+    friend class ConcurrentGraph;
+
+    Snapshot(const ConcurrentGraph *graph, Version version,
+             std::size_t numNodes)
+        : graph_(graph), version_(version), numNodes_(numNodes) {}
+
+    const ConcurrentGraph *graph_{};
+    Version version_{};
+    std::size_t numNodes_{};
+  };
+
+  ConcurrentGraph();
+  ~ConcurrentGraph();
+
+  ConcurrentGraph(const ConcurrentGraph &) = delete;
+  auto operator=(const ConcurrentGraph &) -> ConcurrentGraph & = delete;
+
+  auto addNode(Color color) -> NodeId;
+  void addEdge(NodeId source, NodeId destination);
+
+  auto snapshot() const -> Snapshot;
+
+ private:
+  struct EdgeHash {
+    auto operator()(const Graph::Edge &edge) const -> std::size_t;
+  };
+
+  static constexpr auto NUM_SEGMENTS = std::size_t(48);
+
+  std::array<std::unique_ptr<Node[]>, NUM_SEGMENTS> nodeSegments_{};
+  std::array<std::atomic<Block *>, NUM_COLORS> nodesByColor_{};
+  std::atomic<std::size_t> numNodes_{};
+  std::atomic<Version> version_{};
+
+  std::vector<std::unique_ptr<Block>> blocks_{};
+  std::unordered_set<Graph::Edge, EdgeHash> edges_{};
+
+  auto nodeAt(NodeId nodeId) const -> Node &;
+  void append(std::atomic<Block *> *block, NodeId nodeId, Version version);
+  static auto makeRange(const std::atomic<Block *> &block, Version version)
+      -> NodeRange;
+};
+
+}  // namespace graph
@@ -0,0 +1,228 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <future>
+#include <unordered_set>
+
+#include "are_connected.h"
+#include "concurrent_graph.h"
+#include "graph_generators.h"
+#include "has_path.h"
+
+namespace graph {
+namespace {
+
+using NodeId = Graph::NodeId;
+using Edge = Graph::Edge;
+
+struct Operation {
+  Opt<Color> color{};
+  Edge edge{};
+};
+using Operations = std::vector<Operation>;
+
+auto createOperations(std::size_t numNodes, std::size_t numEdges,
+                      RandomGenerator *randomGenerator) -> Operations {
+  auto operations = Operations();
+  auto edges = std::unordered_set<std::size_t>();
+  auto numAddedNodes = std::size_t();
+  while (numAddedNodes < numNodes || edges.size() < numEdges) {
+    auto addNode = numAddedNodes < 2 || edges.size() == numEdges ||
+                   (numAddedNodes < numNodes && (*randomGenerator)() % 4 == 0);
+    if (addNode) {
+      operations.push_back(
+          {Color((*randomGenerator)() % NUM_COLORS), Edge()});
+      numAddedNodes++;
+      continue;
+    }
+
+    auto source = NodeId((*randomGenerator)() % numAddedNodes);
+    auto destination = NodeId((*randomGenerator)() % numAddedNodes);
+    if (edges.insert(source * numNodes + destination).second) {
+      operations.push_back({{}, Edge(source, destination)});
+    }
+  }
+  return operations;
+}
+
+void applyOperation(const Operation &operation, Graph *graph) {
+  if (operation.color) {
+    graph->addNode(*operation.color);
+  } else {
+    graph->addEdge(operation.edge.first, operation.edge.second);
+  }
+}
+
+void applyOperation(const Operation &operation, ConcurrentGraph *graph) {
+  if (operation.color) {
+    graph->addNode(*operation.color);
+  } else {
+    graph->addEdge(operation.edge.first, operation.edge.second);
+  }
+}
+
+template <class NodesT>
+auto toSortedVector(const NodesT &nodes) -> std::vector<NodeId> {
+  auto nodeIds = std::vector<NodeId>(nodes.begin(), nodes.end());
+  std::sort(nodeIds.begin(), nodeIds.end());
+  return nodeIds;
+}
+
+void expectSameGraph(const Graph &expected,
+                     const ConcurrentGraph::Snapshot &actual) {
+  ASSERT_EQ(expected.numNodes(), actual.numNodes());
+  for (auto colorIndex = std::size_t(); colorIndex < NUM_COLORS;
+       colorIndex++) {
+    auto color = Color(colorIndex);
+    EXPECT_EQ(toSortedVector(expected.findNodesByColor(color)),
+              toSortedVector(actual.findNodesByColor(color)));
+  }
+  for (auto nodeId = NodeId(); nodeId < expected.numNodes(); nodeId++) {
+    EXPECT_EQ(expected.colorOf(nodeId), actual.colorOf(nodeId));
+    EXPECT_EQ(toSortedVector(expected.findNodesBySource(nodeId)),
+              toSortedVector(actual.findNodesBySource(nodeId)));
+    EXPECT_EQ(toSortedVector(expected.findNodesByDestination(nodeId)),
+              toSortedVector(actual.findNodesByDestination(nodeId)));
+  }
+}
+
+}  // namespace
+
+class TestConcurrentGraph : public ::testing::TestWithParam<std::size_t> {};
+
+INSTANTIATE_TEST_SUITE_P(TestConcurrentGraph, TestConcurrentGraph,
+                         ::testing::Values(10, 100, 5'000));
+
+TEST_P(TestConcurrentGraph, testSnapshots) {
+  auto numNodes = GetParam();
+  auto randomGenerator = RandomGenerator(4242);
+  auto operations =
+      createOperations(numNodes, 2 * numNodes, &randomGenerator);
+
+  auto expectedGraph = Graph();
+  auto concurrentGraph = ConcurrentGraph();
+  auto oldSnapshot = concurrentGraph.snapshot();
+  auto oldGraph = Graph();
+  for (auto i = std::size_t(); i < operations.size(); i++) {
+    applyOperation(operations[i], &expectedGraph);
+    applyOperation(operations[i], &concurrentGraph);
+    if (i == operations.size() / 2) {
+      oldSnapshot = concurrentGraph.snapshot();
+      oldGraph = expectedGraph;
+    }
+  }
+
+  auto snapshot = concurrentGraph.snapshot();
+  EXPECT_EQ(operations.size(), snapshot.version());
+  expectSameGraph(expectedGraph, snapshot);
+  expectSameGraph(oldGraph, oldSnapshot);
+
+  for (auto i = 0; i < 100; i++) {
+    auto source = NodeId(randomGenerator() % numNodes);
+    auto destination = NodeId(randomGenerator() % numNodes);
+    EXPECT_EQ(areConnected(expectedGraph, source, destination),
+              areConnected(snapshot, source, destination))
+        << source << " -> " << destination;
+    EXPECT_EQ(areConnected(oldGraph, source, destination),
+              areConnected(oldSnapshot, source, destination))
+        << source << " -> " << destination;
+
+    auto colorList = createRandomColorList(1 + i % 4, &randomGenerator);
+    EXPECT_EQ(hasPath(expectedGraph, colorList), hasPath(snapshot, colorList))
+        << "colorList: " << toString(colorList);
+    EXPECT_EQ(hasPath(oldGraph, colorList), hasPath(oldSnapshot, colorList))
+        << "colorList: " << toString(colorList);
+  }
+}
+
+TEST(TestConcurrentGraph_Invalid, testInvalidEdge) {
+  auto graph = ConcurrentGraph();
+  graph.addNode(Color::Black);
+  EXPECT_THROW(graph.addEdge(0, 1), std::runtime_error);
+  EXPECT_THROW(graph.addEdge(1, 0), std::runtime_error);
+}
+
+TEST(TestConcurrentGraph_Invalid, testInvalidColor) {
+  auto graph = ConcurrentGraph();
+  EXPECT_THROW(graph.addNode(Color(NUM_COLORS)), std::runtime_error);
+  EXPECT_EQ(0, graph.snapshot().numNodes());
+}
+
+// --- TestConcurrentGraph_Stress ---
+
+class TestConcurrentGraph_Stress
+    : public ::testing::TestWithParam<unsigned> {};
+
+INSTANTIATE_TEST_SUITE_P(TestConcurrentGraph_Stress,
+                         TestConcurrentGraph_Stress,
+                         ::testing::Values(1, 2, 4));
+
+TEST_P(TestConcurrentGraph_Stress, testReadersDuringWrites) {
+  constexpr auto NUM_NODES = std::size_t(20'000);
+  constexpr auto NUM_CHECKS = 5;
+  constexpr auto NUM_QUERIES = 20;
+
+  auto numReaders = GetParam();
+  auto randomGenerator = RandomGenerator(4242);
+  const auto operations =
+      createOperations(NUM_NODES, 4 * NUM_NODES, &randomGenerator);
+
+  auto concurrentGraph = ConcurrentGraph();
+  auto done = std::atomic<bool>();
+  auto writer = std::async(std::launch::async, [&]() {
+    for (const auto &operation : operations) {
+      applyOperation(operation, &concurrentGraph);
+    }
+    done.store(true);
+  });
+
+  auto readers = std::vector<std::future<void>>();
+  for (auto reader = 0U; reader < numReaders; reader++) {
+    readers.emplace_back(std::async(std::launch::async, [&, reader]() {
+      auto readerGenerator = RandomGenerator(reader);
+      auto previousVersion = ConcurrentGraph::Version();
+      for (auto check = 0; check < NUM_CHECKS; check++) {
+        auto snapshot = concurrentGraph.snapshot();
+        EXPECT_LE(previousVersion, snapshot.version());
+        previousVersion = snapshot.version();
+
+        auto expectedGraph = Graph();
+        for (auto i = std::size_t(); i < snapshot.version(); i++) {
+          applyOperation(operations[i], &expectedGraph);
+        }
+        expectSameGraph(expectedGraph, snapshot);
+        if (expectedGraph.numNodes() == 0) continue;
+
+        for (auto i = 0; i < NUM_QUERIES; i++) {
+          auto source = NodeId(readerGenerator() % expectedGraph.numNodes());
+          auto destination =
+              NodeId(readerGenerator() % expectedGraph.numNodes());
+          EXPECT_EQ(areConnected(expectedGraph, source, destination),
+                    areConnected(snapshot, source, destination));
+
+          auto colorList = createRandomColorList(3, &readerGenerator);
+          EXPECT_EQ(hasPath(expectedGraph, colorList),
+                    hasPath(snapshot, colorList));
+        }
+      }
+    }));
+  }
+
+  writer.get();
+  for (auto &reader : readers) {
+    reader.get();
+  }
+  EXPECT_TRUE(done.load());
+  expectSameGraph(
+      [&operations]() {
+        auto graph = Graph();
+        for (const auto &operation : operations) {
+          applyOperation(operation, &graph);
+        }
+        return graph;
+      }(),
+      concurrentGraph.snapshot());
+}
+
+}  // namespace graph
@@ -0,0 +1,70 @@
+#include <benchmark/benchmark.h>
+
+#include <filesystem>
+
+#include "are_connected.h"
+#include "frozen_graph.h"
+#include "graph_generators.h"
+
+namespace {
+
+constexpr auto NUM_QUERIES = std::size_t(64);
+constexpr auto EDGES_PER_NODE = std::size_t(4);
+
+auto getGraphPath(std::size_t numEdges) -> std::string {
+  auto path = std::filesystem::temp_directory_path() /
+              ("bench_frozen_graph_" + std::to_string(numEdges));
+  return path.string();
+}
+
+void BM_FrozenGraphFromEdgeList(benchmark::State &state) {
+  auto numEdges = std::size_t(state.range(0));
+  auto numNodes = numEdges / EDGES_PER_NODE;
+  for (auto _ : state) {
+    auto randomGenerator = graph::RandomGenerator(4242);
+    auto frozenGraph =
+        graph::createRandomGraph(numNodes, numEdges, &randomGenerator)
+            .freeze();
+    for (auto i = std::size_t(); i < NUM_QUERIES; i++) {
+      benchmark::DoNotOptimize(graph::areConnected(
+          frozenGraph, randomGenerator() % numNodes,
+          randomGenerator() % numNodes));
+    }
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+void BM_FrozenGraphLoad(benchmark::State &state) {
+  auto numEdges = std::size_t(state.range(0));
+  auto numNodes = numEdges / EDGES_PER_NODE;
+  auto path = getGraphPath(numEdges);
+  {
+    auto randomGenerator = graph::RandomGenerator(4242);
+    graph::createRandomGraph(numNodes, numEdges, &randomGenerator)
+        .freeze()
+        .save(path);
+  }
+
+  for (auto _ : state) {
+    auto randomGenerator = graph::RandomGenerator(4242);
+    auto frozenGraph = graph::FrozenGraph::load(path);
+    for (auto i = std::size_t(); i < NUM_QUERIES; i++) {
+      benchmark::DoNotOptimize(graph::areConnected(
+          frozenGraph, randomGenerator() % numNodes,
+          randomGenerator() % numNodes));
+    }
+  }
+  state.SetComplexityN(state.range(0));
+  std::filesystem::remove(path);
+}
+
+}  // namespace
+
+BENCHMARK(BM_FrozenGraphFromEdgeList)
+    ->RangeMultiplier(10)
+    ->Range(100'000, 10'000'000)
+    ->Complexity();
+BENCHMARK(BM_FrozenGraphLoad)
+    ->RangeMultiplier(10)
+    ->Range(100'000, 10'000'000)
+    ->Complexity();
@@ -0,0 +1,334 @@
+#include "frozen_graph.h"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+#include "mapped_file.h"
+
+namespace graph {
+namespace {
+
+using NodeId = FrozenGraph::NodeId;
+using Weight = FrozenGraph::Weight;
+
+constexpr auto FILE_MAGIC = std::array<char, 8>{'F', 'R', 'O', 'Z',
+                                                'E', 'N', 'G', '\0'};
+constexpr auto FILE_VERSION = std::uint32_t(2);
+constexpr auto FILE_ALIGNMENT = std::size_t(8);
+
+static_assert(sizeof(NodeId) == sizeof(std::size_t));
+
+struct FileHeader {
+  std::array<char, 8> magic{};
+  std::uint32_t version{};
+  std::uint32_t wordSize{};
+  std::uint64_t numNodes{};
+  std::uint64_t numEdges{};
+  std::uint64_t numColors{};
+};
+
+struct FileLayout {
+  std::size_t colors{};
+  std::size_t colorOffsets{};
+  std::size_t nodesByColor{};
+  std::size_t sourceOffsets{};
+  std::size_t nodesBySource{};
+  std::size_t weightsBySource{};
+  std::size_t destinationOffsets{};
+  std::size_t nodesByDestination{};
+  std::size_t size{};
+};
+
+auto computeFileLayout(std::size_t numNodes, std::size_t numEdges)
+    -> FileLayout {
+  auto offset = sizeof(FileHeader);
+  auto allocate = [&offset](std::size_t numBytes) {
+    auto first = offset;
+    offset += (numBytes + FILE_ALIGNMENT - 1) / FILE_ALIGNMENT * FILE_ALIGNMENT;
+    return first;
+  };
+
+  auto layout = FileLayout();
+  layout.colors = allocate(numNodes * sizeof(Color));
+  layout.colorOffsets = allocate((NUM_COLORS + 1) * sizeof(std::size_t));
+  layout.nodesByColor = allocate(numNodes * sizeof(NodeId));
+  layout.sourceOffsets = allocate((numNodes + 1) * sizeof(std::size_t));
+  layout.nodesBySource = allocate(numEdges * sizeof(NodeId));
+  layout.weightsBySource = allocate(numEdges * sizeof(Weight));
+  layout.destinationOffsets = allocate((numNodes + 1) * sizeof(std::size_t));
+  layout.nodesByDestination = allocate(numEdges * sizeof(NodeId));
+  layout.size = offset;
+  return layout;
+}
+
+template <class T>
+void writeSection(std::ofstream* file, std::size_t offset, const T* data,
+                  std::size_t size) {
+  auto padding = std::array<char, FILE_ALIGNMENT>();
+  auto position = std::size_t(file->tellp());
+  assert(position <= offset && offset - position < FILE_ALIGNMENT);
+  file->write(padding.data(), std::streamsize(offset - position));
+  file->write(reinterpret_cast<const char*>(data),
+              std::streamsize(size * sizeof(T)));
+}
+
+template <class FindNodes>
+void compactNodes(std::size_t numNodes, FindNodes findNodes,
+                  std::vector<std::size_t> *offsets,
+                  std::vector<NodeId> *targets) {
+  offsets->reserve(numNodes + 1);
+  offsets->emplace_back(0);
+  for (auto nodeId = NodeId(); nodeId < numNodes; nodeId++) {
+    const auto &nextNodes = findNodes(nodeId);
+    auto first = targets->size();
+    targets->insert(targets->end(), nextNodes.begin(), nextNodes.end());
+    std::sort(targets->begin() + first, targets->end());
+    offsets->emplace_back(targets->size());
+  }
+}
+
+bool isValidSpans(const std::size_t* offsets, std::size_t numSpans,
+                  const NodeId* targets, std::size_t numTargets,
+                  std::size_t numNodes) {
+  if (offsets[0] != 0 || offsets[numSpans] != numTargets) {
+    return false;
+  }
+  for (auto span = std::size_t(); span < numSpans; span++) {
+    if (offsets[span] > offsets[span + 1] ||
+        offsets[span + 1] > numTargets) {
+      return false;
+    }
+    for (auto target = offsets[span]; target < offsets[span + 1]; target++) {
+      if (targets[target] >= numNodes ||
+          (target > offsets[span] && targets[target - 1] >= targets[target])) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+auto makeSpan(const std::size_t* offsets, std::size_t numOffsets,
+              const NodeId* targets, std::size_t index)
+    -> FrozenGraph::NodeSpan {
+  if (index + 1 >= numOffsets) {
+    return {};
+  }
+  return {targets + offsets[index], targets + offsets[index + 1]};
+}
+
+}  // namespace
+
+struct FrozenGraph::Buffers {
+  std::vector<Color> colors{};
+  std::vector<std::size_t> colorOffsets{};
+  std::vector<NodeId> nodesByColor{};
+  std::vector<std::size_t> sourceOffsets{};
+  std::vector<NodeId> nodesBySource{};
+  std::vector<Weight> weightsBySource{};
+  std::vector<std::size_t> destinationOffsets{};
+  std::vector<NodeId> nodesByDestination{};
+};
+
+bool FrozenGraph::NodeSpan::contains(NodeId nodeId) const {
+  return std::binary_search(begin_, end_, nodeId);
+}
+
+FrozenGraph::FrozenGraph(const Graph &graph) {
+  auto numNodes = graph.numNodes();
+  auto buffers = std::make_shared<Buffers>();
+
+  buffers->colors.reserve(numNodes);
+  for (auto nodeId = NodeId(); nodeId < numNodes; nodeId++) {
+    buffers->colors.emplace_back(graph.colorOf(nodeId));
+  }
+
+  buffers->colorOffsets.resize(NUM_COLORS + 1);
+  for (auto nodeId = NodeId(); nodeId < numNodes; nodeId++) {
+    if (graph.hasNode(nodeId)) {
+      buffers->colorOffsets[std::size_t(graph.colorOf(nodeId)) + 1]++;
+    }
+  }
+  for (auto colorIndex = std::size_t(); colorIndex < NUM_COLORS;
+       colorIndex++) {
+    buffers->colorOffsets[colorIndex + 1] += buffers->colorOffsets[colorIndex];
+  }
+  buffers->nodesByColor.resize(numNodes, Graph::NO_NODE_ID);
+  auto nextSlots = buffers->colorOffsets;
+  for (auto nodeId = NodeId(); nodeId < numNodes; nodeId++) {
+    if (graph.hasNode(nodeId)) {
+      auto colorIndex = std::size_t(graph.colorOf(nodeId));
+      buffers->nodesByColor[nextSlots[colorIndex]++] = nodeId;
+    }
+  }
+
+  compactNodes(
+      numNodes,
+      [&graph](NodeId nodeId) -> const Graph::NodeIds & {
+        return graph.findNodesBySource(nodeId);
+      },
+      &buffers->sourceOffsets, &buffers->nodesBySource);
+  buffers->weightsBySource.reserve(buffers->nodesBySource.size());
+  for (auto nodeId = NodeId(); nodeId < numNodes; nodeId++) {
+    for (auto edge = buffers->sourceOffsets[nodeId];
+         edge < buffers->sourceOffsets[nodeId + 1]; edge++) {
+      buffers->weightsBySource.emplace_back(
+          graph.weightOf(nodeId, buffers->nodesBySource[edge]));
+    }
+  }
+  compactNodes(
+      numNodes,
+      [&graph](NodeId nodeId) -> const Graph::NodeIds & {
+        return graph.findNodesByDestination(nodeId);
+      },
+      &buffers->destinationOffsets, &buffers->nodesByDestination);
+
+  numNodes_ = numNodes;
+  numEdges_ = buffers->nodesBySource.size();
+  colors_ = buffers->colors.data();
+  colorOffsets_ = buffers->colorOffsets.data();
+  nodesByColor_ = buffers->nodesByColor.data();
+  sourceOffsets_ = buffers->sourceOffsets.data();
+  nodesBySource_ = buffers->nodesBySource.data();
+  weightsBySource_ = buffers->weightsBySource.data();
+  destinationOffsets_ = buffers->destinationOffsets.data();
+  nodesByDestination_ = buffers->nodesByDestination.data();
+  storage_ = std::move(buffers);
+}
+
+auto FrozenGraph::load(const std::string& path) -> FrozenGraph {
+  auto mappedFile = std::make_shared<const MappedFile>(path);
+  auto data = mappedFile->data();
+
+  auto header = FileHeader();
+  if (mappedFile->size() < sizeof(header)) {
+    throw std::runtime_error("Invalid graph file: " + path);
+  }
+  std::memcpy(&header, data, sizeof(header));
+  if (header.magic != FILE_MAGIC || header.version != FILE_VERSION ||
+      header.wordSize != sizeof(NodeId) || header.numColors != NUM_COLORS) {
+    throw std::runtime_error("Invalid graph file: " + path);
+  }
+
+  auto numNodes = std::size_t(header.numNodes);
+  auto numEdges = std::size_t(header.numEdges);
+  if (header.numNodes > mappedFile->size() / sizeof(NodeId) ||
+      header.numEdges > mappedFile->size() / sizeof(NodeId)) {
+    throw std::runtime_error("Invalid graph file: " + path);
+  }
+  auto layout = computeFileLayout(numNodes, numEdges);
+  if (mappedFile->size() != layout.size) {
+    throw std::runtime_error("Invalid graph file: " + path);
+  }
+
+  auto frozenGraph = FrozenGraph();
+  frozenGraph.numNodes_ = numNodes;
+  frozenGraph.numEdges_ = numEdges;
+  frozenGraph.colors_ = reinterpret_cast<const Color*>(data + layout.colors);
+  frozenGraph.colorOffsets_ =
+      reinterpret_cast<const std::size_t*>(data + layout.colorOffsets);
+  frozenGraph.nodesByColor_ =
+      reinterpret_cast<const NodeId*>(data + layout.nodesByColor);
+  frozenGraph.sourceOffsets_ =
+      reinterpret_cast<const std::size_t*>(data + layout.sourceOffsets);
+  frozenGraph.nodesBySource_ =
+      reinterpret_cast<const NodeId*>(data + layout.nodesBySource);
+  frozenGraph.weightsBySource_ =
+      reinterpret_cast<const Weight*>(data + layout.weightsBySource);
+  frozenGraph.destinationOffsets_ =
+      reinterpret_cast<const std::size_t*>(data + layout.destinationOffsets);
+  frozenGraph.nodesByDestination_ =
+      reinterpret_cast<const NodeId*>(data + layout.nodesByDestination);
+  frozenGraph.storage_ = std::move(mappedFile);
+
+  auto numColorNodes = frozenGraph.colorOffsets_[NUM_COLORS];
+  auto isValidColor = [](Color color) {
+    return std::size_t(color) < NUM_COLORS;
+  };
+  auto isValidWeight = [](Weight weight) { return weight >= 0; };
+  if (numColorNodes > numNodes ||
+      !std::all_of(frozenGraph.colors_, frozenGraph.colors_ + numNodes,
+                   isValidColor) ||
+      !isValidSpans(frozenGraph.colorOffsets_, NUM_COLORS,
+                    frozenGraph.nodesByColor_, numColorNodes, numNodes) ||
+      !isValidSpans(frozenGraph.sourceOffsets_, numNodes,
+                    frozenGraph.nodesBySource_, numEdges, numNodes) ||
+      !std::all_of(frozenGraph.weightsBySource_,
+                   frozenGraph.weightsBySource_ + numEdges, isValidWeight) ||
+      !isValidSpans(frozenGraph.destinationOffsets_, numNodes,
+                    frozenGraph.nodesByDestination_, numEdges, numNodes)) {
+    throw std::runtime_error("Invalid graph file: " + path);
+  }
+  return frozenGraph;
+}
+
+void FrozenGraph::save(const std::string& path) const {
+  auto file = std::ofstream(path, std::ios::binary | std::ios::trunc);
+  if (!file) {
+    throw std::runtime_error("Cannot open file: " + path);
+  }
+
+  auto header = FileHeader();
+  header.magic = FILE_MAGIC;
+  header.version = FILE_VERSION;
+  header.wordSize = sizeof(NodeId);
+  header.numNodes = numNodes_;
+  header.numEdges = numEdges_;
+  header.numColors = NUM_COLORS;
+  file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+  auto emptyOffsets = std::array<std::size_t, NUM_COLORS + 1>();
+  auto layout = computeFileLayout(numNodes_, numEdges_);
+  writeSection(&file, layout.colors, colors_, numNodes_);
+  writeSection(&file, layout.colorOffsets,
+               colorOffsets_ ? colorOffsets_ : emptyOffsets.data(),
+               NUM_COLORS + 1);
+  writeSection(&file, layout.nodesByColor, nodesByColor_, numNodes_);
+  writeSection(&file, layout.sourceOffsets,
+               sourceOffsets_ ? sourceOffsets_ : emptyOffsets.data(),
+               numNodes_ + 1);
+  writeSection(&file, layout.nodesBySource, nodesBySource_, numEdges_);
+  writeSection(&file, layout.weightsBySource, weightsBySource_, numEdges_);
+  writeSection(&file, layout.destinationOffsets,
+               destinationOffsets_ ? destinationOffsets_ : emptyOffsets.data(),
+               numNodes_ + 1);
+  writeSection(&file, layout.nodesByDestination, nodesByDestination_,
+               numEdges_);
+  writeSection(&file, layout.size, static_cast<const char*>(nullptr), 0);
+
+  if (!file) {
+    throw std::runtime_error("Cannot write file: " + path);
+  }
+}
+
+auto FrozenGraph::findNodesByColor(Color color) const -> NodeSpan {
+  auto numOffsets = colorOffsets_ ? NUM_COLORS + 1 : 0;
+  return makeSpan(colorOffsets_, numOffsets, nodesByColor_,
+                  std::size_t(color));
+}
+
+auto FrozenGraph::findNodesBySource(NodeId sourceNode) const -> NodeSpan {
+  return makeSpan(sourceOffsets_, numNodes_ + 1, nodesBySource_, sourceNode);
+}
+
+auto FrozenGraph::findWeightsBySource(NodeId sourceNode) const
+    -> const Weight* {
+  if (sourceNode >= numNodes_) {
+    return nullptr;
+  }
+  return weightsBySource_ + sourceOffsets_[sourceNode];
+}
+
+auto FrozenGraph::findNodesByDestination(NodeId destinationNode) const
+    -> NodeSpan {
+  return makeSpan(destinationOffsets_, numNodes_ + 1, nodesByDestination_,
+                  destinationNode);
+}
+
+}  // namespace graph
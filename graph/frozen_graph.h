@@ -0,0 +1,64 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "color.h"
+#include "graph.h"
+
+namespace graph {
+
+class FrozenGraph {
+ public:
+  using NodeId = Graph::NodeId;
+  using Weight = Graph::Weight;
+
+  class NodeSpan {
+   public:
+    NodeSpan() = default;
+    NodeSpan(const NodeId *begin, const NodeId *end)
+        : begin_(begin), end_(end) {}
+
+    auto begin() const -> const NodeId * { return begin_; }
+    auto end() const -> const NodeId * { return end_; }
+    bool empty() const { return begin_ == end_; }
+    auto size() const -> std::size_t { return std::size_t(end_ - begin_); }
+    bool contains(NodeId nodeId) const;
+
+   private:
+    const NodeId *begin_{};
+    const NodeId *end_{};
+  };
+
+  FrozenGraph() = default;
+  explicit FrozenGraph(const Graph &graph);
+
+  static auto load(const std::string &path) -> FrozenGraph;
+  void save(const std::string &path) const;
+
+  auto numNodes() const -> std::size_t { return numNodes_; }
+  auto numEdges() const -> std::size_t { return numEdges_; }
+  auto colorOf(NodeId nodeId) const -> Color { return colors_[nodeId]; }
+
+  auto findNodesByColor(Color color) const -> NodeSpan;
+  auto findNodesBySource(NodeId sourceNode) const -> NodeSpan;
+  auto findNodesByDestination(NodeId destinationNode) const -> NodeSpan;
+  auto findWeightsBySource(NodeId sourceNode) const -> const Weight *;
+
+ private:
+  struct Buffers;
+
+  std::shared_ptr<const void> storage_{};
+  std::size_t numNodes_{};
+  std::size_t numEdges_{};
+  const Color *colors_{};
+  const std::size_t *colorOffsets_{};
+  const NodeId *nodesByColor_{};
+  const std::size_t *sourceOffsets_{};
+  const NodeId *nodesBySource_{};
+  const Weight *weightsBySource_{};
+  const std::size_t *destinationOffsets_{};
+  const NodeId *nodesByDestination_{};
+};
+
+}  // namespace graph
@@ -0,0 +1,231 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+#include "are_connected.h"
+#include "frozen_graph.h"
+#include "graph_generators.h"
+#include "has_path.h"
+
+namespace graph {
+namespace {
+
+using NodeId = FrozenGraph::NodeId;
+
+auto getTempPath(const std::string &name) -> std::string {
+  return ::testing::TempDir() + name;
+}
+
+auto readFile(const std::string &path) -> std::string {
+  auto file = std::ifstream(path, std::ios::binary);
+  return {std::istreambuf_iterator<char>(file), {}};
+}
+
+void writeFile(const std::string &path, const std::string &content) {
+  std::ofstream(path, std::ios::binary | std::ios::trunc) << content;
+}
+
+auto toVector(FrozenGraph::NodeSpan nodeSpan) -> std::vector<NodeId> {
+  return {nodeSpan.begin(), nodeSpan.end()};
+}
+
+}  // namespace
+
+class TestFrozenGraphFile : public ::testing::TestWithParam<std::size_t> {
+ protected:
+  static void expectSameGraph(const FrozenGraph &expected,
+                              const FrozenGraph &actual);
+};
+
+INSTANTIATE_TEST_SUITE_P(TestFrozenGraphFile, TestFrozenGraphFile,
+                         ::testing::Values(0, 1, 10, 100, 1'000));
+
+TEST_P(TestFrozenGraphFile, testSaveAndLoad) {
+  auto numNodes = GetParam();
+  auto randomGenerator = RandomGenerator(4242);
+  auto graph = createRandomGraph(numNodes, 2 * numNodes, &randomGenerator);
+  for (auto i = std::size_t(); i < numNodes; i++) {
+    graph.addEdge(i, randomGenerator() % numNodes,
+                  double(randomGenerator() % 100) / 10);
+  }
+  auto frozenGraph = graph.freeze();
+
+  auto path = getTempPath("frozen_graph_" + std::to_string(numNodes));
+  frozenGraph.save(path);
+  auto loadedGraph = FrozenGraph::load(path);
+  expectSameGraph(frozenGraph, loadedGraph);
+
+  for (auto i = 0; i < 100 && numNodes > 0; i++) {
+    auto source = NodeId(randomGenerator() % numNodes);
+    auto destination = NodeId(randomGenerator() % numNodes);
+    EXPECT_EQ(areConnected(graph, source, destination),
+              areConnected(loadedGraph, source, destination))
+        << source << " -> " << destination;
+
+    auto colorList = createRandomColorList(1 + i % 4, &randomGenerator);
+    EXPECT_EQ(hasPath(graph, colorList), hasPath(loadedGraph, colorList));
+  }
+}
+
+TEST_P(TestFrozenGraphFile, testFreezeAfterRemovals) {
+  auto numNodes = GetParam();
+  auto randomGenerator = RandomGenerator(4242);
+  auto graph = createRandomGraph(numNodes, 2 * numNodes, &randomGenerator);
+  for (auto i = std::size_t(); i < numNodes / 3; i++) {
+    auto nodeId = NodeId(randomGenerator() % numNodes);
+    if (graph.hasNode(nodeId)) {
+      graph.removeNode(nodeId);
+    }
+  }
+  auto frozenGraph = graph.freeze();
+
+  ASSERT_EQ(graph.numNodes(), frozenGraph.numNodes());
+  for (auto colorIndex = std::size_t(); colorIndex < NUM_COLORS;
+       colorIndex++) {
+    auto color = Color(colorIndex);
+    auto expectedNodeIds = graph.findNodesByColor(color);
+    std::sort(expectedNodeIds.begin(), expectedNodeIds.end());
+    EXPECT_EQ(expectedNodeIds, toVector(frozenGraph.findNodesByColor(color)));
+  }
+
+  auto path = getTempPath("frozen_graph_removed_" + std::to_string(numNodes));
+  frozenGraph.save(path);
+  auto loadedGraph = FrozenGraph::load(path);
+  expectSameGraph(frozenGraph, loadedGraph);
+
+  for (auto i = 0; i < 100 && numNodes > 0; i++) {
+    auto source = NodeId(randomGenerator() % numNodes);
+    auto destination = NodeId(randomGenerator() % numNodes);
+    if (graph.hasNode(source) && graph.hasNode(destination)) {
+      EXPECT_EQ(areConnected(graph, source, destination),
+                areConnected(loadedGraph, source, destination))
+          << source << " -> " << destination;
+    }
+
+    auto colorList = createRandomColorList(1 + i % 4, &randomGenerator);
+    EXPECT_EQ(hasPath(graph, colorList), hasPath(frozenGraph, colorList));
+    EXPECT_EQ(hasPath(graph, colorList), hasPath(loadedGraph, colorList));
+  }
+}
+
+TEST_P(TestFrozenGraphFile, testCopyOutlivesOriginal) {
+  auto numNodes = GetParam();
+  auto randomGenerator = RandomGenerator(4242);
+  auto frozenGraph =
+      createRandomGraph(numNodes, 2 * numNodes, &randomGenerator).freeze();
+
+  auto path = getTempPath("frozen_graph_copy_" + std::to_string(numNodes));
+  frozenGraph.save(path);
+  auto copiedGraph = FrozenGraph();
+  {
+    auto loadedGraph = FrozenGraph::load(path);
+    copiedGraph = loadedGraph;
+  }
+  expectSameGraph(frozenGraph, copiedGraph);
+}
+
+void TestFrozenGraphFile::expectSameGraph(const FrozenGraph &expected,
+                                          const FrozenGraph &actual) {
+  ASSERT_EQ(expected.numNodes(), actual.numNodes());
+  ASSERT_EQ(expected.numEdges(), actual.numEdges());
+  for (auto colorIndex = std::size_t(); colorIndex < NUM_COLORS;
+       colorIndex++) {
+    auto color = Color(colorIndex);
+    EXPECT_EQ(toVector(expected.findNodesByColor(color)),
+              toVector(actual.findNodesByColor(color)));
+  }
+  for (auto nodeId = NodeId(); nodeId < expected.numNodes(); nodeId++) {
+    EXPECT_EQ(expected.colorOf(nodeId), actual.colorOf(nodeId));
+    EXPECT_EQ(toVector(expected.findNodesBySource(nodeId)),
+              toVector(actual.findNodesBySource(nodeId)));
+    auto expectedWeights = expected.findWeightsBySource(nodeId);
+    auto actualWeights = actual.findWeightsBySource(nodeId);
+    for (auto i = std::size_t();
+         i < expected.findNodesBySource(nodeId).size(); i++) {
+      EXPECT_EQ(expectedWeights[i], actualWeights[i]);
+    }
+    EXPECT_EQ(toVector(expected.findNodesByDestination(nodeId)),
+              toVector(actual.findNodesByDestination(nodeId)));
+  }
+}
+
+// --- TestFrozenGraphFile_Invalid ---
+
+TEST(TestFrozenGraphFile_Invalid, testMissingFile) {
+  EXPECT_THROW(FrozenGraph::load(getTempPath("frozen_graph_missing")),
+               std::runtime_error);
+}
+
+TEST(TestFrozenGraphFile_Invalid, testEmptyFile) {
+  auto path = getTempPath("frozen_graph_empty");
+  std::ofstream(path, std::ios::binary | std::ios::trunc);
+  EXPECT_THROW(FrozenGraph::load(path), std::runtime_error);
+}
+
+TEST(TestFrozenGraphFile_Invalid, testTruncatedFile) {
+  auto randomGenerator = RandomGenerator(4242);
+  auto path = getTempPath("frozen_graph_truncated");
+  createRandomGraph(10, 20, &randomGenerator).freeze().save(path);
+
+  auto content = std::string();
+  {
+    auto file = std::ifstream(path, std::ios::binary);
+    content.assign(std::istreambuf_iterator<char>(file), {});
+  }
+  content.resize(content.size() - 8);
+  std::ofstream(path, std::ios::binary | std::ios::trunc) << content;
+
+  EXPECT_THROW(FrozenGraph::load(path), std::runtime_error);
+}
+
+TEST(TestFrozenGraphFile_Invalid, testWrongMagic) {
+  auto path = getTempPath("frozen_graph_magic");
+  std::ofstream(path, std::ios::binary | std::ios::trunc)
+      << std::string(64, 'x');
+  EXPECT_THROW(FrozenGraph::load(path), std::runtime_error);
+}
+
+TEST(TestFrozenGraphFile_Invalid, testCorruptWords) {
+  auto randomGenerator = RandomGenerator(4242);
+  auto path = getTempPath("frozen_graph_corrupt");
+  createRandomGraph(16, 32, &randomGenerator).freeze().save(path);
+  auto content = readFile(path);
+  ASSERT_EQ(0, content.size() % sizeof(std::uint64_t));
+
+  for (auto offset = std::size_t(); offset < content.size();
+       offset += sizeof(std::uint64_t)) {
+    auto corruptContent = content;
+    std::memset(&corruptContent[offset], 0xff, sizeof(std::uint64_t));
+    writeFile(path, corruptContent);
+    EXPECT_THROW(FrozenGraph::load(path), std::runtime_error)
+        << "offset: " << offset;
+  }
+}
+
+TEST(TestFrozenGraphFile_Invalid, testUnsortedSpan) {
+  auto graph = Graph();
+  for (auto i = 0; i < 8; i++) {
+    graph.addNode(Color::Red);
+  }
+  graph.addEdge(0, 3);
+  graph.addEdge(0, 5);
+  auto path = getTempPath("frozen_graph_unsorted");
+  graph.freeze().save(path);
+  auto content = readFile(path);
+
+  auto sortedTargets = std::array<NodeId, 2>{3, 5};
+  auto unsortedTargets = std::array<NodeId, 2>{5, 3};
+  auto offset = content.rfind(std::string(
+      reinterpret_cast<const char *>(sortedTargets.data()),
+      sizeof(sortedTargets)));
+  ASSERT_NE(std::string::npos, offset);
+  std::memcpy(&content[offset], unsortedTargets.data(),
+              sizeof(unsortedTargets));
+  writeFile(path, content);
+
+  EXPECT_THROW(FrozenGraph::load(path), std::runtime_error);
+}
+
+}  // namespace graph
@@ -0,0 +1,127 @@
+#include <benchmark/benchmark.h>
+
+#include "graph_generators.h"
+
+namespace {
+
+constexpr auto EDGES_PER_NODE = std::size_t(4);
+
+struct EdgeListInput {
+  std::vector<graph::Color> colors{};
+  graph::Graph::EdgeList edges{};
+};
+
+auto createEdgeListInput(std::size_t numEdges) -> EdgeListInput {
+  auto numNodes = numEdges / EDGES_PER_NODE;
+  auto randomGenerator = graph::RandomGenerator(4242);
+
+  auto input = EdgeListInput();
+  for (auto i = std::size_t(); i < numNodes; i++) {
+    input.colors.push_back(
+        graph::Color(randomGenerator() % graph::NUM_COLORS));
+  }
+  for (auto i = std::size_t(); i < numEdges; i++) {
+    input.edges.emplace_back(randomGenerator() % numNodes,
+                             randomGenerator() % numNodes);
+  }
+  return input;
+}
+
+void BM_AddEdge(benchmark::State &state) {
+  auto input = createEdgeListInput(std::size_t(state.range(0)));
+  for (auto _ : state) {
+    auto graph = graph::Graph();
+    for (auto color : input.colors) {
+      graph.addNode(color);
+    }
+    for (auto [source, destination] : input.edges) {
+      graph.addEdge(source, destination);
+    }
+    benchmark::DoNotOptimize(graph);
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+template <unsigned MAX_THREADS>
+void BM_FromEdgeList(benchmark::State &state) {
+  auto input = createEdgeListInput(std::size_t(state.range(0)));
+  for (auto _ : state) {
+    auto graph =
+        graph::Graph::fromEdgeList(input.colors, input.edges, MAX_THREADS);
+    benchmark::DoNotOptimize(graph);
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+void BM_RemoveNode(benchmark::State &state) {
+  auto numNodes = std::size_t(state.range(0));
+  auto randomGenerator = graph::RandomGenerator(4242);
+  auto graph = graph::createRandomGraph(numNodes, EDGES_PER_NODE * numNodes,
+                                        &randomGenerator);
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto removedGraph = graph;
+    state.ResumeTiming();
+    for (auto nodeId = graph::Graph::NodeId(); nodeId < numNodes;
+         nodeId += 2) {
+      removedGraph.removeNode(nodeId);
+    }
+    benchmark::DoNotOptimize(removedGraph);
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+template <bool COMPACT>
+void BM_HasPathAfterRemovals(benchmark::State &state) {
+  constexpr auto NUM_COLOR_LISTS = std::size_t(16);
+
+  auto numNodes = std::size_t(state.range(0));
+  auto randomGenerator = graph::RandomGenerator(4242);
+  auto graph = graph::createRandomGraph(2 * numNodes, 2 * numNodes,
+                                        &randomGenerator);
+  for (auto nodeId = graph::Graph::NodeId(); nodeId < 2 * numNodes;
+       nodeId += 2) {
+    graph.removeNode(nodeId);
+  }
+  if (COMPACT) {
+    graph.compact();
+  }
+  auto colorLists = std::vector<graph::ColorList>();
+  for (auto i = std::size_t(); i < NUM_COLOR_LISTS; i++) {
+    colorLists.push_back(graph::createRandomColorList(5, &randomGenerator));
+  }
+
+  for (auto _ : state) {
+    for (const auto &colorList : colorLists) {
+      benchmark::DoNotOptimize(graph.hasPath(colorList));
+    }
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+}  // namespace
+
+BENCHMARK(BM_AddEdge)
+    ->RangeMultiplier(10)
+    ->Range(10'000, 1'000'000)
+    ->Complexity();
+BENCHMARK_TEMPLATE(BM_FromEdgeList, 1)
+    ->RangeMultiplier(10)
+    ->Range(10'000, 1'000'000)
+    ->Complexity();
+BENCHMARK_TEMPLATE(BM_FromEdgeList, 4)
+    ->RangeMultiplier(10)
+    ->Range(10'000, 1'000'000)
+    ->Complexity();
+BENCHMARK(BM_RemoveNode)
+    ->RangeMultiplier(10)
+    ->Range(10'000, 1'000'000)
+    ->Complexity();
+BENCHMARK_TEMPLATE(BM_HasPathAfterRemovals, false)
+    ->RangeMultiplier(10)
+    ->Range(10'000, 1'000'000)
+    ->Complexity();
+BENCHMARK_TEMPLATE(BM_HasPathAfterRemovals, true)
+    ->RangeMultiplier(10)
+    ->Range(10'000, 1'000'000)
+    ->Complexity();
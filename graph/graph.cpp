@@ -1,39 +1,326 @@
 #include "graph.h"
 
+#include <algorithm>
+#include <array>
 #include <cassert>
+#include <future>
 #include <stdexcept>
+#include <thread>
 
 #include "are_connected.h"
+#include "frozen_graph.h"
 #include "has_path.h"
+#include "reachability_index.h"
 
 
 namespace graph {
+namespace {
+
+using NodeId = Graph::NodeId;
+using NodeIds = Graph::NodeIds;
+using Edge = Graph::Edge;
+using EdgeList = Graph::EdgeList;
+
+constexpr auto MIN_EDGES_PER_THREAD = std::size_t(100'000);
+constexpr auto NODES_PER_REMOVED_NODE = std::size_t(4);
+
+auto getNumberOfCpus() -> unsigned {
+  return std::thread::hardware_concurrency();
+}
+
+template <class Function>
+void runInParallel(std::size_t numItems, unsigned numThreads,
+                   const Function& function) {
+  if (numThreads <= 1 || numItems == 0) {
+    function(std::size_t(0), numItems);
+    return;
+  }
+
+  auto tasks = std::vector<std::future<void>>();
+  auto partSize = (numItems + numThreads - 1) / numThreads;
+  for (auto first = std::size_t(); first < numItems; first += partSize) {
+    auto last = std::min(numItems, first + partSize);
+    tasks.emplace_back(
+        std::async(std::launch::async, [&function, first, last]() {
+          function(first, last);
+        }));
+  }
+  for (auto& task : tasks) {
+    task.get();
+  }
+}
+
+void sortEdges(EdgeList* edges, unsigned numThreads) {
+  auto numEdges = edges->size();
+  auto partSize = (numEdges + numThreads - 1) / std::max(numThreads, 1U);
+  runInParallel(numEdges, numThreads, [edges](std::size_t first,
+                                              std::size_t last) {
+    std::sort(edges->begin() + first, edges->begin() + last);
+  });
+
+  for (; partSize < numEdges; partSize *= 2) {
+    auto numMerges = (numEdges + 2 * partSize - 1) / (2 * partSize);
+    runInParallel(numMerges, numThreads, [=](std::size_t first,
+                                             std::size_t last) {
+      for (auto merge = first; merge < last; merge++) {
+        auto begin = edges->begin() + merge * 2 * partSize;
+        auto middle = std::min(edges->end(), begin + partSize);
+        auto end = std::min(edges->end(), middle + partSize);
+        std::inplace_merge(begin, middle, end);
+      }
+    });
+  }
+}
+
+template <class NodesByNode>
+void eraseNodeId(NodesByNode* nodesByNode, NodeId key, NodeId nodeId) {
+  auto nodeIdsIt = nodesByNode->find(key);
+  if (nodeIdsIt == nodesByNode->end()) {
+    return;
+  }
+  nodeIdsIt->second.erase(nodeId);
+  if (nodeIdsIt->second.empty()) {
+    nodesByNode->erase(nodeIdsIt);
+  }
+}
+
+}  // namespace
+
+auto Graph::fromEdgeList(std::vector<Color> colors, EdgeList edges,
+                         Opt<unsigned> maxThreads) -> Graph {
+  auto numThreads = maxThreads ? maxThreads.value() : getNumberOfCpus();
+  numThreads = unsigned(std::min<std::size_t>(
+      numThreads, edges.size() / MIN_EDGES_PER_THREAD + 1));
+
+  auto numNodes = colors.size();
+  for (auto color : colors) {
+    if (std::size_t(color) >= NUM_COLORS) {
+      throw std::runtime_error("Invalid color");
+    }
+  }
+  runInParallel(edges.size(), numThreads,
+                [&edges, numNodes](std::size_t first, std::size_t last) {
+                  for (auto i = first; i < last; i++) {
+                    if (edges[i].first >= numNodes) {
+                      throw std::runtime_error("Invalid source node id");
+                    }
+                    if (edges[i].second >= numNodes) {
+                      throw std::runtime_error("Invalid destination node id");
+                    }
+                  }
+                });
+
+  sortEdges(&edges, numThreads);
+  edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+
+  auto graph = Graph();
+  graph.colors_ = std::move(colors);
+
+  auto numNodesByColor = std::array<std::size_t, NUM_COLORS>();
+  for (auto color : graph.colors_) {
+    numNodesByColor[std::size_t(color)]++;
+  }
+  for (auto colorIndex = std::size_t(); colorIndex < NUM_COLORS;
+       colorIndex++) {
+    graph.nodesByColor_[colorIndex].reserve(numNodesByColor[colorIndex]);
+  }
+  graph.colorPositions_.resize(numNodes);
+  for (auto nodeId = NodeId(); nodeId < numNodes; nodeId++) {
+    auto& nodeIds = graph.nodesByColor_[std::size_t(graph.colors_[nodeId])];
+    graph.colorPositions_[nodeId] = nodeIds.size();
+    nodeIds.emplace_back(nodeId);
+  }
+
+  auto sourceOffsets = std::vector<std::size_t>(numNodes + 1);
+  auto destinationOffsets = std::vector<std::size_t>(numNodes + 1);
+  for (auto [source, destination] : edges) {
+    sourceOffsets[source + 1]++;
+    destinationOffsets[destination + 1]++;
+  }
+  for (auto nodeId = NodeId(); nodeId < numNodes; nodeId++) {
+    sourceOffsets[nodeId + 1] += sourceOffsets[nodeId];
+    destinationOffsets[nodeId + 1] += destinationOffsets[nodeId];
+  }
+
+  auto sources = std::vector<NodeId>(edges.size());
+  auto nextSlots = destinationOffsets;
+  for (auto [source, destination] : edges) {
+    sources[nextSlots[destination]++] = source;
+  }
+
+  auto numSources = std::size_t();
+  auto numDestinations = std::size_t();
+  for (auto nodeId = NodeId(); nodeId < numNodes; nodeId++) {
+    numSources += sourceOffsets[nodeId + 1] > sourceOffsets[nodeId];
+    numDestinations +=
+        destinationOffsets[nodeId + 1] > destinationOffsets[nodeId];
+  }
+  graph.nodesBySource_.reserve(numSources);
+  graph.nodesByDestination_.reserve(numDestinations);
+
+  auto nodesBySource = std::vector<NodeIds*>(numNodes);
+  auto nodesByDestination = std::vector<NodeIds*>(numNodes);
+  for (auto nodeId = NodeId(); nodeId < numNodes; nodeId++) {
+    auto numDestinations = sourceOffsets[nodeId + 1] - sourceOffsets[nodeId];
+    if (numDestinations > 0) {
+      nodesBySource[nodeId] = &graph.nodesBySource_[nodeId];
+      nodesBySource[nodeId]->reserve(numDestinations);
+    }
+    auto numSources =
+        destinationOffsets[nodeId + 1] - destinationOffsets[nodeId];
+    if (numSources > 0) {
+      nodesByDestination[nodeId] = &graph.nodesByDestination_[nodeId];
+      nodesByDestination[nodeId]->reserve(numSources);
+    }
+  }
+
+  runInParallel(numNodes, numThreads, [&](std::size_t first,
+                                          std::size_t last) {
+    for (auto nodeId = first; nodeId < last; nodeId++) {
+      if (nodesBySource[nodeId]) {
+        for (auto edge = sourceOffsets[nodeId];
+             edge < sourceOffsets[nodeId + 1]; edge++) {
+          nodesBySource[nodeId]->insert(edges[edge].second);
+        }
+      }
+      if (nodesByDestination[nodeId]) {
+        nodesByDestination[nodeId]->insert(
+            sources.begin() + destinationOffsets[nodeId],
+            sources.begin() + destinationOffsets[nodeId + 1]);
+      }
+    }
+  });
+
+  return graph;
+}
 
 auto Graph::addNode(Color color) -> NodeId {
-  auto nodeId = nextNodeId_;
-  nextNodeId_++;
-  nodesByColor_[color].insert(nodeId);
+  if (std::size_t(color) >= NUM_COLORS) {
+    throw std::runtime_error("Invalid color");
+  }
+  auto nodeId = NodeId(colors_.size());
+  auto& nodeIds = nodesByColor_[std::size_t(color)];
+  colors_.emplace_back(color);
+  colorPositions_.emplace_back(nodeIds.size());
+  nodeIds.emplace_back(nodeId);
+  reachabilityIndex_.reset();
   return nodeId;
 }
 
-void Graph::addEdge(NodeId source, NodeId destination) {
-  if (source >= nextNodeId_) {
+void Graph::addEdge(NodeId source, NodeId destination, Weight weight) {
+  if (!hasNode(source)) {
     throw std::runtime_error("Invalid source node id");
   }
-  if (destination >= nextNodeId_) {
+  if (!hasNode(destination)) {
     throw std::runtime_error("Invalid destination node id");
   }
+  if (!(weight >= 0)) {
+    throw std::runtime_error("Invalid edge weight");
+  }
   nodesBySource_[source].insert(destination);
   nodesByDestination_[destination].insert(source);
+  if (weight != 1) {
+    weightsBySource_[source][destination] = weight;
+  } else if (!weightsBySource_.empty()) {
+    eraseNodeId(&weightsBySource_, source, destination);
+  }
+  reachabilityIndex_.reset();
 }
 
-auto Graph::findNodesByColor(Color color) const -> const NodeIds& {
-  auto nodesByColorIt = nodesByColor_.find(color);
-  if (nodesByColorIt == nodesByColor_.end()) {
-    static const auto NO_NODE_IDS = NodeIds();
+void Graph::removeEdge(NodeId source, NodeId destination) {
+  if (!hasNode(source)) {
+    throw std::runtime_error("Invalid source node id");
+  }
+  if (!hasNode(destination)) {
+    throw std::runtime_error("Invalid destination node id");
+  }
+  eraseNodeId(&nodesBySource_, source, destination);
+  eraseNodeId(&nodesByDestination_, destination, source);
+  if (!weightsBySource_.empty()) {
+    eraseNodeId(&weightsBySource_, source, destination);
+  }
+  reachabilityIndex_.reset();
+}
+
+void Graph::removeNode(NodeId nodeId) {
+  if (!hasNode(nodeId)) {
+    throw std::runtime_error("Invalid node id");
+  }
+
+  auto destinationsIt = nodesBySource_.find(nodeId);
+  if (destinationsIt != nodesBySource_.end()) {
+    for (auto destination : destinationsIt->second) {
+      if (destination != nodeId) {
+        eraseNodeId(&nodesByDestination_, destination, nodeId);
+      }
+    }
+    nodesBySource_.erase(destinationsIt);
+    weightsBySource_.erase(nodeId);
+  }
+  auto sourcesIt = nodesByDestination_.find(nodeId);
+  if (sourcesIt != nodesByDestination_.end()) {
+    for (auto source : sourcesIt->second) {
+      if (source != nodeId) {
+        eraseNodeId(&nodesBySource_, source, nodeId);
+        if (!weightsBySource_.empty()) {
+          eraseNodeId(&weightsBySource_, source, nodeId);
+        }
+      }
+    }
+    nodesByDestination_.erase(sourcesIt);
+  }
+
+  auto& nodeIds = nodesByColor_[std::size_t(colors_[nodeId])];
+  auto position = colorPositions_[nodeId];
+  nodeIds[position] = nodeIds.back();
+  colorPositions_[nodeIds[position]] = position;
+  nodeIds.pop_back();
+  colorPositions_[nodeId] = REMOVED_NODE;
+  numRemovedNodes_++;
+  reachabilityIndex_.reset();
+}
+
+auto Graph::compact() -> NodeList {
+  auto newNodeIds = NodeList(colors_.size(), NO_NODE_ID);
+  auto colors = std::vector<Color>();
+  colors.reserve(colors_.size() - numRemovedNodes_);
+  for (auto nodeId = NodeId(); nodeId < colors_.size(); nodeId++) {
+    if (hasNode(nodeId)) {
+      newNodeIds[nodeId] = colors.size();
+      colors.push_back(colors_[nodeId]);
+    }
+  }
+
+  auto edges = EdgeList();
+  for (const auto& [source, destinations] : nodesBySource_) {
+    for (auto destination : destinations) {
+      edges.emplace_back(newNodeIds[source], newNodeIds[destination]);
+    }
+  }
+
+  auto graph = fromEdgeList(std::move(colors), std::move(edges));
+  for (const auto& [source, weights] : weightsBySource_) {
+    auto& newWeights = graph.weightsBySource_[newNodeIds[source]];
+    newWeights.reserve(weights.size());
+    for (auto [destination, weight] : weights) {
+      newWeights.emplace(newNodeIds[destination], weight);
+    }
+  }
+  *this = std::move(graph);
+  return newNodeIds;
+}
+
+bool Graph::needsCompaction() const {
+  return numRemovedNodes_ > 0 &&
+         numRemovedNodes_ * NODES_PER_REMOVED_NODE >= colors_.size();
+}
+
+auto Graph::findNodesByColor(Color color) const -> const NodeList& {
+  if (std::size_t(color) >= NUM_COLORS) {
+    static const auto NO_NODE_IDS = NodeList();
     return NO_NODE_IDS;
   }
-  return nodesByColorIt->second;
+  return nodesByColor_[std::size_t(color)];
 }
 
 auto Graph::findNodesBySource(NodeId sourceNode) const -> const NodeIds& {
@@ -55,12 +342,41 @@ auto Graph::findNodesByDestination(NodeId destinationNode) const
   return edgesIt->second;
 }
 
+auto Graph::weightOf(NodeId source, NodeId destination) const -> Weight {
+  const auto& weights = findWeightsBySource(source);
+  auto weightIt = weights.find(destination);
+  if (weightIt == weights.end()) {
+    return 1;
+  }
+  return weightIt->second;
+}
+
+auto Graph::findWeightsBySource(NodeId sourceNode) const -> const Weights& {
+  auto weightsIt = weightsBySource_.find(sourceNode);
+  if (weightsIt == weightsBySource_.end()) {
+    static const auto NO_WEIGHTS = Weights();
+    return NO_WEIGHTS;
+  }
+  return weightsIt->second;
+}
+
 bool Graph::hasPath(const ColorList& colorList) const {
   return graph::hasPath(*this, colorList);
 }
 
-bool Graph::areConnected(NodeId source, NodeId destination) const {
-  return graph::areConnected(*this, source, destination);
+bool Graph::areConnected(NodeId source, NodeId destination,
+                         AreConnectedScratch* scratch) const {
+  if (reachabilityIndex_) {
+    return reachabilityIndex_->areConnected(source, destination, scratch);
+  }
+  return graph::areConnected(*this, source, destination, scratch);
+}
+
+auto Graph::freeze() const -> FrozenGraph { return FrozenGraph(*this); }
+
+void Graph::buildReachabilityIndex() {
+  reachabilityIndex_.reset();
+  reachabilityIndex_ = std::make_shared<const ReachabilityIndex>(*this);
 }
 
 }  // namespace graph
@@ -1,9 +1,14 @@
 #pragma once
 
+#include <array>
 #include <deque>
+#include <limits>
+#include <memory>
+#include <optional>
 #include <tuple>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "color.h"
@@ -11,26 +16,74 @@
 
 namespace graph {
 
+template <class T>
+using Opt = std::optional<T>;
+
+class AreConnectedScratch;
+class FrozenGraph;
+class ReachabilityIndex;
+
 class Graph {
  public:
   using NodeId = std::size_t;
   using NodeIds = std::unordered_set<NodeId>;
+  using NodeList = std::vector<NodeId>;
+  using Edge = std::pair<NodeId, NodeId>;
+  using EdgeList = std::vector<Edge>;
+  using Weight = double;
+  using Weights = std::unordered_map<NodeId, Weight>;
+
+  static constexpr auto NO_NODE_ID = std::numeric_limits<NodeId>::max();
+
+  static auto fromEdgeList(std::vector<Color> colors, EdgeList edges,
+                           Opt<unsigned> maxThreads = {}) -> Graph;
 
   auto addNode(Color color) -> NodeId;
-  void addEdge(NodeId source, NodeId destination);
+  void addEdge(NodeId source, NodeId destination, Weight weight = 1);
+  void removeEdge(NodeId source, NodeId destination);
+  void removeNode(NodeId nodeId);
+  auto compact() -> NodeList;
 
-  auto findNodesByColor(Color color) const -> const NodeIds &;
+  auto numNodes() const -> std::size_t { return colors_.size(); }
+  auto numRemovedNodes() const -> std::size_t { return numRemovedNodes_; }
+  bool hasNode(NodeId nodeId) const {
+    return nodeId < colorPositions_.size() &&
+           colorPositions_[nodeId] != REMOVED_NODE;
+  }
+  bool needsCompaction() const;
+  auto colorOf(NodeId nodeId) const -> Color { return colors_[nodeId]; }
+  // Listed in no particular order. To test whether a node has a colour,
+  // compare colorOf(nodeId) instead of searching this list.
+  auto findNodesByColor(Color color) const -> const NodeList &;
   auto findNodesBySource(NodeId sourceNode) const -> const NodeIds &;
   auto findNodesByDestination(NodeId destinationNode) const -> const NodeIds &;
+  auto weightOf(NodeId source, NodeId destination) const -> Weight;
+  // Only weights other than 1 are stored. Searches that relax many weighted
+  // edges should run on a FrozenGraph, which keeps weights next to targets.
+  auto findWeightsBySource(NodeId sourceNode) const -> const Weights &;
 
   bool hasPath(const ColorList &colorList) const;
-  bool areConnected(NodeId source, NodeId destination) const;
+  bool areConnected(NodeId source, NodeId destination,
+                    AreConnectedScratch *scratch = nullptr) const;
+
+  auto freeze() const -> FrozenGraph;
+
+  void buildReachabilityIndex();
+  auto reachabilityIndex() const -> const ReachabilityIndex * {
+    return reachabilityIndex_.get();
+  }
 
  private:
-  NodeId nextNodeId_{};
-  std::unordered_map<Color, NodeIds> nodesByColor_{};
+  static constexpr auto REMOVED_NODE = std::numeric_limits<std::size_t>::max();
+
+  std::vector<Color> colors_{};
+  std::vector<std::size_t> colorPositions_{};
+  std::size_t numRemovedNodes_{};
+  std::array<NodeList, NUM_COLORS> nodesByColor_{};
   std::unordered_map<NodeId, NodeIds> nodesBySource_{};
   std::unordered_map<NodeId, NodeIds> nodesByDestination_{};
+  std::unordered_map<NodeId, Weights> weightsBySource_{};
+  std::shared_ptr<const ReachabilityIndex> reachabilityIndex_{};
 };
 
 }  // namespace graph
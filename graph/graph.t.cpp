@@ -0,0 +1,222 @@
+#include <gtest/gtest.h>
+
+#include "graph.h"
+#include "graph_generators.h"
+
+namespace graph {
+namespace {
+
+using NodeId = Graph::NodeId;
+using Edge = Graph::Edge;
+using EdgeList = Graph::EdgeList;
+
+struct TestCase_FromEdgeList {
+  std::size_t numNodes{};
+  std::size_t numEdges{};
+  unsigned maxThreads{};
+};
+
+}  // namespace
+
+class TestFromEdgeList
+    : public ::testing::TestWithParam<TestCase_FromEdgeList> {
+ public:
+  using TestCase = TestCase_FromEdgeList;
+
+  static auto getTestName(const ::testing::TestParamInfo<TestCase> &testInfo)
+      -> std::string {
+    const auto &testCase = testInfo.param;
+    return "nodes_" + std::to_string(testCase.numNodes) + "_edges_" +
+           std::to_string(testCase.numEdges) + "_threads_" +
+           std::to_string(testCase.maxThreads);
+  }
+
+ protected:
+  static void expectSameGraph(const Graph &expected, const Graph &actual);
+};
+
+INSTANTIATE_TEST_SUITE_P(
+    TestFromEdgeList, TestFromEdgeList,
+    testing::Values(TestFromEdgeList::TestCase{0, 0, 1},
+                    TestFromEdgeList::TestCase{1, 0, 1},
+                    TestFromEdgeList::TestCase{1, 10, 1},
+                    TestFromEdgeList::TestCase{10, 100, 1},
+                    TestFromEdgeList::TestCase{10, 100, 4},
+                    TestFromEdgeList::TestCase{1'000, 10'000, 3},
+                    TestFromEdgeList::TestCase{10'000, 1'000'000, 1},
+                    TestFromEdgeList::TestCase{10'000, 1'000'000, 4},
+                    TestFromEdgeList::TestCase{100'000, 1'000'000, 7}),
+    &TestFromEdgeList::getTestName);
+
+TEST_P(TestFromEdgeList, testFromEdgeList) {
+  const auto &testCase = GetParam();
+  auto randomGenerator = RandomGenerator(4242);
+
+  auto colors = std::vector<Color>();
+  for (auto i = std::size_t(); i < testCase.numNodes; i++) {
+    colors.push_back(Color(randomGenerator() % NUM_COLORS));
+  }
+  auto edges = EdgeList();
+  for (auto i = std::size_t(); i < testCase.numEdges; i++) {
+    edges.emplace_back(randomGenerator() % testCase.numNodes,
+                       randomGenerator() % testCase.numNodes);
+  }
+
+  auto expected = Graph();
+  for (auto color : colors) {
+    expected.addNode(color);
+  }
+  for (auto [source, destination] : edges) {
+    expected.addEdge(source, destination);
+  }
+
+  auto actual = Graph::fromEdgeList(colors, edges, testCase.maxThreads);
+  expectSameGraph(expected, actual);
+}
+
+TEST(TestFromEdgeList_Invalid, testInvalidSource) {
+  EXPECT_THROW(Graph::fromEdgeList({Color::Black}, {{0, 0}, {1, 0}}),
+               std::runtime_error);
+}
+
+TEST(TestFromEdgeList_Invalid, testInvalidDestination) {
+  EXPECT_THROW(Graph::fromEdgeList({Color::Black, Color::Red}, {{0, 2}}),
+               std::runtime_error);
+}
+
+TEST(TestFromEdgeList_Invalid, testInvalidColor) {
+  EXPECT_THROW(
+      Graph::fromEdgeList({Color::Black, Color(NUM_COLORS)}, {{0, 1}}),
+      std::runtime_error);
+}
+
+// --- TestRemove ---
+
+TEST(TestRemove, testRemoveEdge) {
+  auto graph = Graph();
+  auto a = graph.addNode(Color::Red);
+  auto b = graph.addNode(Color::Green);
+  graph.addEdge(a, b, 2.5);
+  graph.addEdge(b, a);
+  ASSERT_TRUE(graph.hasPath({Color::Red, Color::Green}));
+
+  graph.removeEdge(a, b);
+  EXPECT_TRUE(graph.findNodesBySource(a).empty());
+  EXPECT_TRUE(graph.findNodesByDestination(b).empty());
+  EXPECT_EQ(Graph::NodeIds{a}, graph.findNodesBySource(b));
+  EXPECT_FALSE(graph.hasPath({Color::Red, Color::Green}));
+  EXPECT_TRUE(graph.hasPath({Color::Green, Color::Red}));
+
+  graph.addEdge(a, b);
+  EXPECT_EQ(1, graph.weightOf(a, b));
+  graph.removeEdge(a, a);
+  EXPECT_THROW(graph.removeEdge(a, 2), std::runtime_error);
+}
+
+TEST(TestRemove, testRemoveNode) {
+  auto graph = Graph();
+  auto a = graph.addNode(Color::Red);
+  auto b = graph.addNode(Color::Green);
+  auto c = graph.addNode(Color::Red);
+  graph.addEdge(a, b);
+  graph.addEdge(b, c);
+  graph.addEdge(b, b);
+  graph.buildReachabilityIndex();
+  ASSERT_TRUE(graph.areConnected(a, c));
+
+  graph.removeNode(b);
+  EXPECT_FALSE(graph.hasNode(b));
+  EXPECT_TRUE(graph.hasNode(c));
+  EXPECT_EQ(3, graph.numNodes());
+  EXPECT_EQ(1, graph.numRemovedNodes());
+  EXPECT_EQ(nullptr, graph.reachabilityIndex());
+  EXPECT_TRUE(graph.findNodesBySource(a).empty());
+  EXPECT_TRUE(graph.findNodesByDestination(c).empty());
+  EXPECT_TRUE(graph.findNodesByColor(Color::Green).empty());
+  EXPECT_EQ(2, graph.findNodesByColor(Color::Red).size());
+  EXPECT_FALSE(graph.areConnected(a, c));
+  EXPECT_FALSE(graph.hasPath({Color::Green}));
+
+  EXPECT_THROW(graph.removeNode(b), std::runtime_error);
+  EXPECT_THROW(graph.addEdge(a, b), std::runtime_error);
+  EXPECT_THROW(graph.removeEdge(b, c), std::runtime_error);
+}
+
+TEST(TestRemove, testRemoveWeightedEdges) {
+  auto graph = Graph();
+  auto a = graph.addNode(Color::Red);
+  auto b = graph.addNode(Color::Green);
+  auto c = graph.addNode(Color::Blue);
+  graph.addEdge(a, b, 2.0);
+  graph.addEdge(b, c, 3.0);
+  graph.addEdge(c, b, 4.0);
+  EXPECT_EQ((Graph::Weights{{b, 2.0}}), graph.findWeightsBySource(a));
+  EXPECT_EQ(4.0, graph.weightOf(c, b));
+
+  graph.removeEdge(a, b);
+  EXPECT_TRUE(graph.findWeightsBySource(a).empty());
+
+  graph.removeNode(b);
+  EXPECT_TRUE(graph.findWeightsBySource(b).empty());
+  EXPECT_TRUE(graph.findWeightsBySource(c).empty());
+
+  graph.addEdge(a, c, 5.0);
+  EXPECT_EQ(5.0, graph.weightOf(a, c));
+  graph.addEdge(a, c);
+  EXPECT_EQ(1.0, graph.weightOf(a, c));
+  EXPECT_TRUE(graph.findWeightsBySource(a).empty());
+}
+
+TEST(TestRemove, testCompact) {
+  auto randomGenerator = RandomGenerator(4242);
+  auto graph = createRandomGraph(1'000, 5'000, &randomGenerator);
+  graph.addEdge(1, 2, 3.0);
+  auto expected = graph;
+  for (auto nodeId = NodeId(); nodeId < graph.numNodes(); nodeId += 3) {
+    graph.removeNode(nodeId);
+  }
+  ASSERT_TRUE(graph.needsCompaction());
+
+  auto newNodeIds = graph.compact();
+  EXPECT_EQ(666, graph.numNodes());
+  EXPECT_EQ(0, graph.numRemovedNodes());
+  EXPECT_FALSE(graph.needsCompaction());
+  ASSERT_EQ(1'000, newNodeIds.size());
+  for (auto nodeId = NodeId(); nodeId < newNodeIds.size(); nodeId++) {
+    auto newNodeId = newNodeIds[nodeId];
+    if (nodeId % 3 == 0) {
+      EXPECT_EQ(Graph::NO_NODE_ID, newNodeId);
+      continue;
+    }
+    ASSERT_LT(newNodeId, graph.numNodes());
+    EXPECT_EQ(expected.colorOf(nodeId), graph.colorOf(newNodeId));
+    auto expectedDestinations = Graph::NodeIds();
+    for (auto destination : expected.findNodesBySource(nodeId)) {
+      if (destination % 3 != 0) {
+        expectedDestinations.insert(newNodeIds[destination]);
+      }
+    }
+    EXPECT_EQ(expectedDestinations, graph.findNodesBySource(newNodeId));
+  }
+  EXPECT_EQ(3.0, graph.weightOf(newNodeIds[1], newNodeIds[2]));
+}
+
+void TestFromEdgeList::expectSameGraph(const Graph &expected,
+                                       const Graph &actual) {
+  ASSERT_EQ(expected.numNodes(), actual.numNodes());
+  for (auto colorIndex = std::size_t(); colorIndex < NUM_COLORS;
+       colorIndex++) {
+    auto color = Color(colorIndex);
+    EXPECT_EQ(expected.findNodesByColor(color),
+              actual.findNodesByColor(color));
+  }
+  for (auto nodeId = NodeId(); nodeId < expected.numNodes(); nodeId++) {
+    EXPECT_EQ(expected.colorOf(nodeId), actual.colorOf(nodeId));
+    EXPECT_EQ(expected.findNodesBySource(nodeId),
+              actual.findNodesBySource(nodeId));
+    EXPECT_EQ(expected.findNodesByDestination(nodeId),
+              actual.findNodesByDestination(nodeId));
+  }
+}
+
+}  // namespace graph
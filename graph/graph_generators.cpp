@@ -0,0 +1,115 @@
+#include "graph_generators.h"
+
+#include <cmath>
+
+namespace graph {
+namespace {
+
+using NodeId = Graph::NodeId;
+
+constexpr auto POWER_LAW_EXPONENT = 2.5;
+
+auto createRandomColor(RandomGenerator* randomGenerator) -> Color {
+  return Color(randomGenerator->operator()() % NUM_COLORS);
+}
+
+auto createRandomColors(std::size_t numNodes, RandomGenerator* randomGenerator)
+    -> std::vector<Color> {
+  auto colors = std::vector<Color>();
+  colors.reserve(numNodes);
+  for (auto i = std::size_t(); i < numNodes; i++) {
+    colors.push_back(createRandomColor(randomGenerator));
+  }
+  return colors;
+}
+
+}  // namespace
+
+auto createRandomGraph(std::size_t numNodes, std::size_t numEdges,
+                       RandomGenerator* randomGenerator) -> Graph {
+  auto colors = createRandomColors(numNodes, randomGenerator);
+
+  auto edges = Graph::EdgeList();
+  if (numNodes > 0) {
+    edges.reserve(numEdges);
+    for (auto i = std::size_t(); i < numEdges; i++) {
+      auto source = NodeId(randomGenerator->operator()() % numNodes);
+      auto destination = NodeId(randomGenerator->operator()() % numNodes);
+      edges.emplace_back(source, destination);
+    }
+  }
+
+  return Graph::fromEdgeList(std::move(colors), std::move(edges));
+}
+
+auto createPowerLawGraph(std::size_t numNodes, std::size_t numEdges,
+                         RandomGenerator* randomGenerator) -> Graph {
+  auto colors = createRandomColors(numNodes, randomGenerator);
+
+  auto edges = Graph::EdgeList();
+  if (numNodes > 0) {
+    auto weights = std::vector<double>();
+    weights.reserve(numNodes);
+    for (auto i = std::size_t(); i < numNodes; i++) {
+      weights.push_back(std::pow(double(i + 1), -1 / (POWER_LAW_EXPONENT - 1)));
+    }
+    auto pickNode =
+        std::discrete_distribution<NodeId>(weights.begin(), weights.end());
+
+    edges.reserve(numEdges);
+    for (auto i = std::size_t(); i < numEdges; i++) {
+      auto source = pickNode(*randomGenerator);
+      auto destination = pickNode(*randomGenerator);
+      edges.emplace_back(source, destination);
+    }
+  }
+
+  return Graph::fromEdgeList(std::move(colors), std::move(edges));
+}
+
+auto createGridGraph(std::size_t numRows, std::size_t numColumns,
+                     RandomGenerator* randomGenerator) -> Graph {
+  auto colors = createRandomColors(numRows * numColumns, randomGenerator);
+
+  auto edges = Graph::EdgeList();
+  edges.reserve(4 * numRows * numColumns);
+  for (auto row = std::size_t(); row < numRows; row++) {
+    for (auto column = std::size_t(); column < numColumns; column++) {
+      auto nodeId = NodeId(row * numColumns + column);
+      if (column + 1 < numColumns) {
+        edges.emplace_back(nodeId, nodeId + 1);
+        edges.emplace_back(nodeId + 1, nodeId);
+      }
+      if (row + 1 < numRows) {
+        edges.emplace_back(nodeId, nodeId + numColumns);
+        edges.emplace_back(nodeId + numColumns, nodeId);
+      }
+    }
+  }
+
+  return Graph::fromEdgeList(std::move(colors), std::move(edges));
+}
+
+auto createChainGraph(std::size_t numNodes, RandomGenerator* randomGenerator)
+    -> Graph {
+  auto colors = createRandomColors(numNodes, randomGenerator);
+
+  auto edges = Graph::EdgeList();
+  edges.reserve(numNodes);
+  for (auto nodeId = NodeId(1); nodeId < numNodes; nodeId++) {
+    edges.emplace_back(nodeId - 1, nodeId);
+  }
+
+  return Graph::fromEdgeList(std::move(colors), std::move(edges));
+}
+
+auto createRandomColorList(std::size_t size, RandomGenerator* randomGenerator)
+    -> ColorList {
+  auto colorList = ColorList();
+  for (auto i = std::size_t(); i < size; i++) {
+    colorList.push_back(createRandomColor(randomGenerator));
+  }
+  return colorList;
+}
+
+}  // namespace graph
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <random>
+
+#include "graph.h"
+
+namespace graph {
+
+using RandomGenerator = std::mt19937_64;
+
+auto createRandomGraph(std::size_t numNodes, std::size_t numEdges,
+                       RandomGenerator *randomGenerator) -> Graph;
+
+auto createPowerLawGraph(std::size_t numNodes, std::size_t numEdges,
+                         RandomGenerator *randomGenerator) -> Graph;
+
+auto createGridGraph(std::size_t numRows, std::size_t numColumns,
+                     RandomGenerator *randomGenerator) -> Graph;
+
+auto createChainGraph(std::size_t numNodes, RandomGenerator *randomGenerator)
+    -> Graph;
+
+auto createRandomColorList(std::size_t size, RandomGenerator *randomGenerator)
+    -> ColorList;
+
+}  // namespace graph
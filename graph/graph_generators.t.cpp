@@ -0,0 +1,52 @@
+#include <gtest/gtest.h>
+
+#include "graph_generators.h"
+
+namespace graph {
+namespace {
+
+using NodeId = Graph::NodeId;
+
+auto countEdges(const Graph &graph) -> std::size_t {
+  auto numEdges = std::size_t();
+  for (auto nodeId = NodeId(); nodeId < graph.numNodes(); nodeId++) {
+    numEdges += graph.findNodesBySource(nodeId).size();
+  }
+  return numEdges;
+}
+
+}  // namespace
+
+TEST(TestGraphGenerators, testPowerLawGraph) {
+  auto randomGenerator = RandomGenerator(4242);
+  auto graph = createPowerLawGraph(1'000, 4'000, &randomGenerator);
+  EXPECT_EQ(1'000, graph.numNodes());
+  EXPECT_LE(countEdges(graph), 4'000);
+
+  auto maxDegree = std::size_t();
+  for (auto nodeId = NodeId(); nodeId < graph.numNodes(); nodeId++) {
+    maxDegree = std::max(maxDegree, graph.findNodesBySource(nodeId).size());
+  }
+  EXPECT_GT(maxDegree, 40);
+}
+
+TEST(TestGraphGenerators, testGridGraph) {
+  auto randomGenerator = RandomGenerator(4242);
+  auto graph = createGridGraph(3, 4, &randomGenerator);
+  EXPECT_EQ(12, graph.numNodes());
+  EXPECT_EQ(2 * (3 * 3 + 2 * 4), countEdges(graph));
+  EXPECT_EQ(Graph::NodeIds({1, 4}), graph.findNodesBySource(0));
+  EXPECT_EQ(Graph::NodeIds({1, 4, 6, 9}), graph.findNodesBySource(5));
+}
+
+TEST(TestGraphGenerators, testChainGraph) {
+  auto randomGenerator = RandomGenerator(4242);
+  auto graph = createChainGraph(5, &randomGenerator);
+  EXPECT_EQ(5, graph.numNodes());
+  EXPECT_EQ(4, countEdges(graph));
+  for (auto nodeId = NodeId(1); nodeId < graph.numNodes(); nodeId++) {
+    EXPECT_EQ(Graph::NodeIds({nodeId}), graph.findNodesBySource(nodeId - 1));
+  }
+}
+
+}  // namespace graph
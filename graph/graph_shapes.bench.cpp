@@ -0,0 +1,154 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+
+#include "allocation_counter.h"
+#include "are_connected.h"
+#include "graph_generators.h"
+#include "has_path.h"
+
+namespace {
+
+enum class GraphShape { RANDOM, POWER_LAW, GRID, CHAIN };
+
+constexpr auto NUM_QUERIES = std::size_t(16);
+constexpr auto COLOR_LIST_SIZE = std::size_t(4);
+constexpr auto EDGES_PER_NODE = std::size_t(4);
+
+template <GraphShape shape>
+auto createGraph(std::size_t numNodes, graph::RandomGenerator *randomGenerator)
+    -> graph::Graph {
+  if constexpr (shape == GraphShape::RANDOM) {
+    return graph::createRandomGraph(numNodes, numNodes * EDGES_PER_NODE,
+                                    randomGenerator);
+  } else if constexpr (shape == GraphShape::POWER_LAW) {
+    return graph::createPowerLawGraph(numNodes, numNodes * EDGES_PER_NODE,
+                                      randomGenerator);
+  } else if constexpr (shape == GraphShape::GRID) {
+    auto numRows = std::size_t(std::sqrt(double(numNodes)));
+    return graph::createGridGraph(numRows, numNodes / numRows,
+                                  randomGenerator);
+  } else {
+    return graph::createChainGraph(numNodes, randomGenerator);
+  }
+}
+
+template <GraphShape shape>
+void BM_BuildGraph(benchmark::State &state) {
+  auto numNodes = std::size_t(state.range(0));
+  auto memoryBytes = std::size_t();
+  auto frozenMemoryBytes = std::size_t();
+  for (auto _ : state) {
+    auto randomGenerator = graph::RandomGenerator(4242);
+    auto allocatedBytes = graph::getAllocatedBytes();
+    auto graph = createGraph<shape>(numNodes, &randomGenerator);
+    memoryBytes = graph::getAllocatedBytes() - allocatedBytes;
+
+    state.PauseTiming();
+    allocatedBytes = graph::getAllocatedBytes();
+    auto frozenGraph = graph.freeze();
+    frozenMemoryBytes = graph::getAllocatedBytes() - allocatedBytes;
+    state.ResumeTiming();
+  }
+  state.counters["memoryBytes"] = double(memoryBytes);
+  state.counters["frozenMemoryBytes"] = double(frozenMemoryBytes);
+  state.SetComplexityN(state.range(0));
+}
+
+template <GraphShape shape>
+void BM_HasPathLatency(benchmark::State &state) {
+  auto numNodes = std::size_t(state.range(0));
+  auto randomGenerator = graph::RandomGenerator(4242);
+  auto graph = createGraph<shape>(numNodes, &randomGenerator);
+
+  auto colorLists = std::vector<graph::ColorList>();
+  for (auto i = std::size_t(); i < NUM_QUERIES; i++) {
+    colorLists.emplace_back(
+        graph::createRandomColorList(COLOR_LIST_SIZE, &randomGenerator));
+  }
+
+  auto scratch = graph::HasPathScratch();
+  for (auto _ : state) {
+    for (const auto &colorList : colorLists) {
+      benchmark::DoNotOptimize(graph::hasPath(graph, colorList, &scratch));
+    }
+  }
+  state.SetItemsProcessed(std::int64_t(state.iterations() * NUM_QUERIES));
+  state.SetComplexityN(state.range(0));
+}
+
+template <GraphShape shape>
+void BM_AreConnectedLatency(benchmark::State &state) {
+  using NodeId = graph::Graph::NodeId;
+
+  auto numNodes = std::size_t(state.range(0));
+  auto randomGenerator = graph::RandomGenerator(4242);
+  auto graph = createGraph<shape>(numNodes, &randomGenerator);
+
+  auto queries = std::vector<std::pair<NodeId, NodeId>>();
+  for (auto i = std::size_t(); i < NUM_QUERIES; i++) {
+    queries.emplace_back(randomGenerator() % graph.numNodes(),
+                         randomGenerator() % graph.numNodes());
+  }
+
+  auto scratch = graph::AreConnectedScratch();
+  for (auto _ : state) {
+    for (auto [source, destination] : queries) {
+      benchmark::DoNotOptimize(
+          graph::areConnected(graph, source, destination, &scratch));
+    }
+  }
+  state.SetItemsProcessed(std::int64_t(state.iterations() * NUM_QUERIES));
+  state.SetComplexityN(state.range(0));
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_BuildGraph, GraphShape::RANDOM)
+    ->RangeMultiplier(10)
+    ->Range(1'000, 1'000'000)
+    ->Complexity();
+BENCHMARK_TEMPLATE(BM_BuildGraph, GraphShape::POWER_LAW)
+    ->RangeMultiplier(10)
+    ->Range(1'000, 1'000'000)
+    ->Complexity();
+BENCHMARK_TEMPLATE(BM_BuildGraph, GraphShape::GRID)
+    ->RangeMultiplier(10)
+    ->Range(1'000, 1'000'000)
+    ->Complexity();
+BENCHMARK_TEMPLATE(BM_BuildGraph, GraphShape::CHAIN)
+    ->RangeMultiplier(10)
+    ->Range(1'000, 1'000'000)
+    ->Complexity();
+BENCHMARK_TEMPLATE(BM_HasPathLatency, GraphShape::RANDOM)
+    ->RangeMultiplier(10)
+    ->Range(1'000, 1'000'000)
+    ->Complexity();
+BENCHMARK_TEMPLATE(BM_HasPathLatency, GraphShape::POWER_LAW)
+    ->RangeMultiplier(10)
+    ->Range(1'000, 1'000'000)
+    ->Complexity();
+BENCHMARK_TEMPLATE(BM_HasPathLatency, GraphShape::GRID)
+    ->RangeMultiplier(10)
+    ->Range(1'000, 1'000'000)
+    ->Complexity();
+BENCHMARK_TEMPLATE(BM_HasPathLatency, GraphShape::CHAIN)
+    ->RangeMultiplier(10)
+    ->Range(1'000, 1'000'000)
+    ->Complexity();
+BENCHMARK_TEMPLATE(BM_AreConnectedLatency, GraphShape::RANDOM)
+    ->RangeMultiplier(10)
+    ->Range(1'000, 1'000'000)
+    ->Complexity();
+BENCHMARK_TEMPLATE(BM_AreConnectedLatency, GraphShape::POWER_LAW)
+    ->RangeMultiplier(10)
+    ->Range(1'000, 1'000'000)
+    ->Complexity();
+BENCHMARK_TEMPLATE(BM_AreConnectedLatency, GraphShape::GRID)
+    ->RangeMultiplier(10)
+    ->Range(1'000, 1'000'000)
+    ->Complexity();
+BENCHMARK_TEMPLATE(BM_AreConnectedLatency, GraphShape::CHAIN)
+    ->RangeMultiplier(10)
+    ->Range(1'000, 1'000'000)
+    ->Complexity();
@@ -0,0 +1,152 @@
+
+#include <benchmark/benchmark.h>
+
+#include "graph_generators.h"
+#include "has_path.h"
+
+namespace {
+
+constexpr auto NUM_COLOR_LISTS = std::size_t(16);
+constexpr auto COLOR_LIST_SIZE = std::size_t(5);
+
+auto createColorLists(graph::RandomGenerator *randomGenerator)
+    -> std::vector<graph::ColorList> {
+  auto colorLists = std::vector<graph::ColorList>();
+  for (auto i = std::size_t(); i < NUM_COLOR_LISTS; i++) {
+    colorLists.emplace_back(
+        graph::createRandomColorList(COLOR_LIST_SIZE, randomGenerator));
+  }
+  return colorLists;
+}
+
+void BM_HasPath(benchmark::State &state) {
+  auto numNodes = std::size_t(state.range(0));
+  auto randomGenerator = graph::RandomGenerator(4242);
+  auto graph = graph::createRandomGraph(numNodes, numNodes, &randomGenerator)
+                   .freeze();
+  auto colorLists = createColorLists(&randomGenerator);
+
+  auto scratch = graph::HasPathScratch();
+  for (auto _ : state) {
+    for (const auto &colorList : colorLists) {
+      benchmark::DoNotOptimize(graph::hasPath(graph, colorList, &scratch));
+    }
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+void BM_HasPathWithStats(benchmark::State &state) {
+  auto numNodes = std::size_t(state.range(0));
+  auto randomGenerator = graph::RandomGenerator(4242);
+  auto graph = graph::createRandomGraph(numNodes, numNodes, &randomGenerator)
+                   .freeze();
+  auto colorLists = createColorLists(&randomGenerator);
+
+  auto scratch = graph::HasPathScratch();
+  auto stats = graph::SearchStats();
+  auto edgesScanned = std::size_t();
+  for (auto _ : state) {
+    for (const auto &colorList : colorLists) {
+      benchmark::DoNotOptimize(
+          graph::hasPath(graph, colorList, &scratch, &stats));
+      edgesScanned += stats.edgesScanned;
+    }
+  }
+  state.counters["edgesScanned"] =
+      benchmark::Counter(double(edgesScanned), benchmark::Counter::kIsRate);
+  state.SetComplexityN(state.range(0));
+}
+
+void BM_HasPathWithPattern(benchmark::State &state) {
+  auto numNodes = std::size_t(state.range(0));
+  auto randomGenerator = graph::RandomGenerator(4242);
+  auto graph = graph::createRandomGraph(numNodes, numNodes, &randomGenerator)
+                   .freeze();
+  auto colorPatterns = std::vector<graph::ColorPattern>();
+  for (const auto &colorList : createColorLists(&randomGenerator)) {
+    colorPatterns.push_back(graph::ColorPattern::fromColorList(colorList));
+  }
+
+  auto scratch = graph::HasPathScratch();
+  for (auto _ : state) {
+    for (const auto &colorPattern : colorPatterns) {
+      benchmark::DoNotOptimize(graph::hasPath(graph, colorPattern, &scratch));
+    }
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+template <graph::PathLength pathLength>
+void BM_FindPath(benchmark::State &state) {
+  auto numNodes = std::size_t(state.range(0));
+  auto randomGenerator = graph::RandomGenerator(4242);
+  auto graph = graph::createRandomGraph(numNodes, numNodes, &randomGenerator)
+                   .freeze();
+  auto colorLists = createColorLists(&randomGenerator);
+
+  auto scratch = graph::HasPathScratch();
+  for (auto _ : state) {
+    for (const auto &colorList : colorLists) {
+      benchmark::DoNotOptimize(
+          graph::findPath(graph, colorList, pathLength, &scratch));
+    }
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+template <unsigned maxThreads>
+void BM_HasPathInParallel(benchmark::State &state) {
+  auto numNodes = std::size_t(state.range(0));
+  auto randomGenerator = graph::RandomGenerator(4242);
+  auto graph = graph::createRandomGraph(numNodes, numNodes, &randomGenerator)
+                   .freeze();
+
+  auto colorLists = createColorLists(&randomGenerator);
+
+  for (auto _ : state) {
+    for (const auto &colorList : colorLists) {
+      benchmark::DoNotOptimize(
+          graph::hasPathInParallel(graph, colorList, maxThreads));
+    }
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+}  // namespace
+
+BENCHMARK(BM_HasPath)
+    ->RangeMultiplier(10)
+    ->Range(1'000, 1'000'000)
+    ->Complexity();
+BENCHMARK(BM_HasPathWithStats)
+    ->RangeMultiplier(10)
+    ->Range(1'000, 1'000'000)
+    ->Complexity();
+BENCHMARK(BM_HasPathWithPattern)
+    ->RangeMultiplier(10)
+    ->Range(1'000, 1'000'000)
+    ->Complexity();
+BENCHMARK_TEMPLATE(BM_FindPath, graph::PathLength::ANY)
+    ->RangeMultiplier(10)
+    ->Range(1'000, 1'000'000)
+    ->Complexity();
+BENCHMARK_TEMPLATE(BM_FindPath, graph::PathLength::SHORTEST)
+    ->RangeMultiplier(10)
+    ->Range(1'000, 1'000'000)
+    ->Complexity();
+BENCHMARK_TEMPLATE(BM_HasPathInParallel, 1)
+    ->RangeMultiplier(10)
+    ->Range(1'000, 1'000'000)
+    ->Complexity();
+BENCHMARK_TEMPLATE(BM_HasPathInParallel, 2)
+    ->RangeMultiplier(10)
+    ->Range(1'000, 1'000'000)
+    ->Complexity();
+BENCHMARK_TEMPLATE(BM_HasPathInParallel, 4)
+    ->RangeMultiplier(10)
+    ->Range(1'000, 1'000'000)
+    ->Complexity();
+BENCHMARK_TEMPLATE(BM_HasPathInParallel, 8)
+    ->RangeMultiplier(10)
+    ->Range(1'000, 1'000'000)
+    ->Complexity();
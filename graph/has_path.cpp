@@ -1,144 +1,454 @@
 
 #include "has_path.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
-#include <memory>
-#include <optional>
-#include <queue>
-#include <set>
-#include <tuple>
-#include <vector>
-
+#include <future>
+#include <limits>
+#include <thread>
+#include <utility>
 
 namespace graph {
 namespace {
 
-template <class T>
-using Opt = std::optional<T>;
+constexpr auto BITS_PER_WORD = std::size_t(64);
+constexpr auto SECOND_COLOR_INDEX = std::size_t(1);
+constexpr auto SEEDS_PER_CLAIM = std::size_t(64);
+constexpr auto NO_PARENT = std::numeric_limits<std::size_t>::max();
 
-template <class T>
-using Set = std::set<T>;
+using ColorIndex = HasPathScratch::ColorIndex;
+using NodeId = Graph::NodeId;
+using NodeList = Graph::NodeList;
+using State = HasPathScratch::State;
+using StateId = ColorPattern::StateId;
 
-template <class T>
-using Queue = std::priority_queue<T>;
+struct PathEnd {
+  State state{};
+  Opt<NodeId> lastNodeId{};
+};
 
-template <class T>
-using Shared = std::shared_ptr<T>;
+auto getNumberOfCpus() -> unsigned {
+  return std::thread::hardware_concurrency();
+}
 
-class HasPathTask {
- public:
-  enum class Status { CONTINUE, SUCCESS, FAIL };
+template <bool TRACK_PARENTS, bool COLLECT_STATS = false, class GraphT>
+auto searchPath(const GraphT& graph, const ColorList& colorList,
+                PathLength pathLength, HasPathScratch* scratch,
+                SearchStats* stats = nullptr) -> Opt<PathEnd> {
+  auto recorder = SearchStatsRecorder<COLLECT_STATS>(stats);
+  if (colorList.empty()) {
+    recorder.finish(SearchOutcome::EARLY_FAIL);
+    return {};
+  }
+  for (auto color : colorList) {
+    if (graph.findNodesByColor(color).empty()) {
+      recorder.finish(SearchOutcome::EARLY_FAIL);
+      return {};
+    }
+  }
+  if (colorList.size() == 1) {
+    auto nodeId = *graph.findNodesByColor(colorList.front()).begin();
+    recorder.finish(SearchOutcome::FOUND);
+    return PathEnd{{nodeId, SECOND_COLOR_INDEX}, {}};
+  }
 
-  using ColorIndex = std::size_t;
-  using NodeId = Graph::NodeId;
-  using VisitedNodes = Set<std::tuple<NodeId, ColorIndex>>;
+  scratch->reset(graph.numNodes(), colorList.size(), TRACK_PARENTS);
+
+  auto expand = [&graph, &colorList, scratch, &recorder](
+                    const State& state,
+                    HasPathScratch::Frontier* nextStates) -> Opt<NodeId> {
+    recorder.expandNode();
+    auto nextColor = colorList[state.colorIndex];
+    for (auto nextNodeId : graph.findNodesBySource(state.nodeId)) {
+      recorder.scanEdge();
+      auto nextState = State{nextNodeId, state.colorIndex};
+      if (graph.colorOf(nextNodeId) == nextColor) {
+        nextState.colorIndex++;
+        if (nextState.colorIndex == colorList.size()) {
+          return nextNodeId;
+        }
+      }
+      if (scratch->visit(nextState.nodeId, nextState.colorIndex)) {
+        recorder.visitState();
+        if constexpr (TRACK_PARENTS) {
+          scratch->setParent(nextState, state);
+        }
+        nextStates->push_back(nextState);
+      }
+    }
+    return {};
+  };
+
+  auto& frontier = scratch->frontier();
+  for (auto nodeId : graph.findNodesByColor(colorList.front())) {
+    scratch->visit(nodeId, SECOND_COLOR_INDEX);
+    recorder.visitState();
+    frontier.push_back({nodeId, SECOND_COLOR_INDEX});
+  }
+  recorder.updateQueueSize(frontier.size());
+
+  if (pathLength == PathLength::ANY) {
+    while (!frontier.empty()) {
+      auto state = frontier.back();
+      frontier.pop_back();
+      if (auto lastNodeId = expand(state, &frontier)) {
+        recorder.finish(SearchOutcome::FOUND);
+        return PathEnd{state, lastNodeId};
+      }
+      recorder.updateQueueSize(frontier.size());
+    }
+    recorder.finish(SearchOutcome::EXHAUSTED);
+    return {};
+  }
 
-  HasPathTask() = default;
-  HasPathTask(const Graph& graph, const ColorList& colorList,
-              Shared<VisitedNodes> visitedNodes, NodeId nodeId,
-              ColorIndex colorIndex);
-  HasPathTask(const HasPathTask& other) = default;
-  ~HasPathTask() = default;
+  while (!frontier.empty()) {
+    auto& nextFrontier = scratch->nextFrontier();
+    for (const auto& state : frontier) {
+      if (auto lastNodeId = expand(state, &nextFrontier)) {
+        recorder.finish(SearchOutcome::FOUND);
+        return PathEnd{state, lastNodeId};
+      }
+    }
+    recorder.updateQueueSize(frontier.size() + nextFrontier.size());
+    scratch->swapFrontiers();
+  }
 
-  auto operator=(const HasPathTask& other) -> HasPathTask& = default;
-  bool operator<(const HasPathTask& other) const;
+  recorder.finish(SearchOutcome::EXHAUSTED);
+  return {};
+}
 
-  static auto start(const Graph& graph, const ColorList& colorList,
-                    Queue<HasPathTask>* taskQueue) -> Status;
+template <class GraphT>
+bool searchPathWithStats(const GraphT& graph, const ColorList& colorList,
+                         HasPathScratch* scratch, SearchStats* stats) {
+  if (stats) {
+    return searchPath<false, true>(graph, colorList, PathLength::SHORTEST,
+                                   scratch, stats)
+        .has_value();
+  } else {
+    return searchPath<false>(graph, colorList, PathLength::SHORTEST, scratch)
+        .has_value();
+  }
+}
 
-  auto execute(Queue<HasPathTask>* taskQueue) const -> Status;
+template <class GraphT>
+bool searchPathWithScratch(const GraphT& graph, const ColorList& colorList,
+                           HasPathScratch* scratch,
+                           SearchStats* stats = nullptr) {
+  if (scratch) {
+    return searchPathWithStats(graph, colorList, scratch, stats);
+  } else {
+    auto localScratch = HasPathScratch();
+    return searchPathWithStats(graph, colorList, &localScratch, stats);
+  }
+}
 
- private:
-  const Graph* graph_{};
-  const ColorList* colorList_{};
-  Shared<VisitedNodes> visitedNodes_{};
+template <class GraphT>
+bool searchPattern(const GraphT& graph, const ColorPattern& colorPattern,
+                   HasPathScratch* scratch) {
+  scratch->reset(graph.numNodes(), colorPattern.numStates());
+
+  auto& frontier = scratch->frontier();
+  for (auto colorIndex = std::size_t(); colorIndex < NUM_COLORS;
+       colorIndex++) {
+    auto color = Color(colorIndex);
+    auto stateId = colorPattern.nextState(ColorPattern::START_STATE, color);
+    if (stateId == ColorPattern::DEAD_STATE) continue;
+    const auto& nodes = graph.findNodesByColor(color);
+    if (nodes.empty()) continue;
+    if (colorPattern.isAccepting(stateId)) return true;
+    for (auto nodeId : nodes) {
+      scratch->visit(nodeId, stateId);
+      frontier.push_back({nodeId, stateId});
+    }
+  }
 
-  NodeId nodeId_{};
-  std::size_t colorIndex_{};
-};
+  while (!frontier.empty()) {
+    auto& nextFrontier = scratch->nextFrontier();
+    for (const auto& state : frontier) {
+      for (auto nextNodeId : graph.findNodesBySource(state.nodeId)) {
+        auto nextStateId = colorPattern.nextState(StateId(state.colorIndex),
+                                                  graph.colorOf(nextNodeId));
+        if (nextStateId == ColorPattern::DEAD_STATE) continue;
+        if (colorPattern.isAccepting(nextStateId)) return true;
+        if (scratch->visit(nextNodeId, nextStateId)) {
+          nextFrontier.push_back({nextNodeId, nextStateId});
+        }
+      }
+    }
+    scratch->swapFrontiers();
+  }
 
-HasPathTask::HasPathTask(const Graph& graph, const ColorList& colorList,
-                         Shared<VisitedNodes> visitedNodes, NodeId nodeId,
-                         ColorIndex colorIndex)
-    : graph_(&graph),
-      colorList_(&colorList),
-      visitedNodes_(visitedNodes),
-      nodeId_(nodeId),
-      colorIndex_(colorIndex) {
-  assert(graph_ != nullptr);
-  assert(colorList_ != nullptr);
+  return false;
 }
 
-bool HasPathTask::operator<(const HasPathTask& other) const {
-  return colorIndex_ < other.colorIndex_;
+template <class GraphT>
+bool searchPatternWithScratch(const GraphT& graph,
+                              const ColorPattern& colorPattern,
+                              HasPathScratch* scratch) {
+  if (scratch) {
+    return searchPattern(graph, colorPattern, scratch);
+  } else {
+    auto localScratch = HasPathScratch();
+    return searchPattern(graph, colorPattern, &localScratch);
+  }
 }
 
-auto HasPathTask::start(const Graph& graph, const ColorList& colorList,
-                        Queue<HasPathTask>* taskQueue) -> Status {
-  if (colorList.empty()) return Status::FAIL;
+auto buildPath(const PathEnd& pathEnd, const HasPathScratch& scratch)
+    -> NodeList {
+  if (!pathEnd.lastNodeId) {
+    return {pathEnd.state.nodeId};
+  }
 
-  auto firstColor = colorList.front();
-  auto nodeIds = graph.findNodesByColor(firstColor);
-  if (nodeIds.empty()) return Status::FAIL;
-  if (colorList.size() == 1) return Status::SUCCESS;
+  auto path = NodeList();
+  for (auto state = Opt<State>(pathEnd.state); state;
+       state = scratch.parentOf(*state)) {
+    path.push_back(state->nodeId);
+  }
+  std::reverse(path.begin(), path.end());
+  path.push_back(*pathEnd.lastNodeId);
+  return path;
+}
 
-  auto visitedNodes = std::make_shared<VisitedNodes>();
+template <class GraphT>
+auto findPathWithScratch(const GraphT& graph, const ColorList& colorList,
+                         PathLength pathLength, HasPathScratch* scratch)
+    -> NodeList {
+  if (scratch) {
+    auto pathEnd = searchPath<true>(graph, colorList, pathLength, scratch);
+    return pathEnd ? buildPath(*pathEnd, *scratch) : NodeList();
+  } else {
+    auto localScratch = HasPathScratch();
+    auto pathEnd =
+        searchPath<true>(graph, colorList, pathLength, &localScratch);
+    return pathEnd ? buildPath(*pathEnd, localScratch) : NodeList();
+  }
+}
 
-  for (auto nodeId : nodeIds) {
-    constexpr auto FIRST_COLOR_INDEX = std::size_t(0);
-    visitedNodes->emplace(nodeId, FIRST_COLOR_INDEX);
-    taskQueue->emplace(graph, colorList, visitedNodes, nodeId,
-                       FIRST_COLOR_INDEX + 1);
+class SharedVisitedStates {
+ public:
+  SharedVisitedStates(std::size_t numNodes, std::size_t numColorIndexes)
+      : numColorIndexes_(numColorIndexes),
+        words_((numNodes * numColorIndexes + BITS_PER_WORD - 1) /
+               BITS_PER_WORD) {}
+
+  bool visit(NodeId nodeId, ColorIndex colorIndex) {
+    auto stateId = nodeId * numColorIndexes_ + colorIndex;
+    auto& word = words_[stateId / BITS_PER_WORD];
+    auto mask = std::uint64_t(1) << (stateId % BITS_PER_WORD);
+    if (word.load(std::memory_order_relaxed) & mask) {
+      return false;
+    }
+    return !(word.fetch_or(mask, std::memory_order_relaxed) & mask);
   }
 
-  return Status::CONTINUE;
-}
+ private:
+  std::size_t numColorIndexes_{};
+  std::vector<std::atomic<std::uint64_t>> words_;
+};
+
+template <class GraphT>
+class ParallelSearch {
+ public:
+  ParallelSearch(const GraphT& graph, const ColorList& colorList);
+
+  auto run(unsigned numThreads) -> bool;
+
+ private:
+  const GraphT* graph_{};
+  const ColorList* colorList_{};
+  SharedVisitedStates visitedStates_;
+  std::atomic<std::size_t> nextSeed_{};
+  std::atomic<bool> found_{};
 
-auto HasPathTask::execute(Queue<HasPathTask>* taskQueue) const -> Status {
-  auto nextColor = colorList_->at(colorIndex_);
-  const auto& nodesWithNextColor = graph_->findNodesByColor(nextColor);
-  if (nodesWithNextColor.empty()) {
-    return Status::CONTINUE;
+  void runWorker();
+  bool expand(const State& state, std::vector<State>* stack);
+};
+
+template <class GraphT>
+ParallelSearch<GraphT>::ParallelSearch(const GraphT& graph,
+                                       const ColorList& colorList)
+    : graph_(&graph),
+      colorList_(&colorList),
+      visitedStates_(graph.numNodes(), colorList.size()) {}
+
+template <class GraphT>
+auto ParallelSearch<GraphT>::run(unsigned numThreads) -> bool {
+  auto workers = std::vector<std::future<void>>();
+  workers.resize(numThreads);
+  for (auto& worker : workers) {
+    worker = std::async(std::launch::async, &ParallelSearch::runWorker, this);
   }
+  for (auto& worker : workers) {
+    worker.get();
+  }
+
+  return found_.load();
+}
 
-  for (auto nextNodeId : graph_->findNodesBySource(nodeId_)) {
-    auto taskId = std::make_tuple(nextNodeId, colorIndex_);
-    auto [_, firstVisit] = visitedNodes_->emplace(taskId);
-    if (!firstVisit) {
-      continue;
+template <class GraphT>
+void ParallelSearch<GraphT>::runWorker() {
+  const auto& seeds = graph_->findNodesByColor(colorList_->front());
+  auto numSeeds = std::size_t(seeds.size());
+
+  auto stack = std::vector<State>();
+  while (!found_.load(std::memory_order_relaxed)) {
+    auto firstSeed = nextSeed_.fetch_add(SEEDS_PER_CLAIM);
+    if (firstSeed >= numSeeds) {
+      return;
+    }
+    auto lastSeed = std::min(numSeeds, firstSeed + SEEDS_PER_CLAIM);
+    for (auto seedIt = seeds.begin() + firstSeed;
+         seedIt != seeds.begin() + lastSeed; ++seedIt) {
+      if (visitedStates_.visit(*seedIt, SECOND_COLOR_INDEX)) {
+        stack.push_back({*seedIt, SECOND_COLOR_INDEX});
+      }
     }
 
-    if (nodesWithNextColor.count(nextNodeId)) {
-      auto nextColorIndex = colorIndex_ + 1;
+    while (!stack.empty()) {
+      auto state = stack.back();
+      stack.pop_back();
+      if (expand(state, &stack)) {
+        found_.store(true);
+        return;
+      }
+      if (found_.load(std::memory_order_relaxed)) {
+        return;
+      }
+    }
+  }
+}
+
+template <class GraphT>
+bool ParallelSearch<GraphT>::expand(const State& state,
+                                    std::vector<State>* stack) {
+  auto nextColor = (*colorList_)[state.colorIndex];
+  for (auto nextNodeId : graph_->findNodesBySource(state.nodeId)) {
+    auto nextColorIndex = state.colorIndex;
+    if (graph_->colorOf(nextNodeId) == nextColor) {
+      nextColorIndex++;
       if (nextColorIndex == colorList_->size()) {
-        return Status::SUCCESS;
+        return true;
       }
-      taskQueue->emplace(*graph_, *colorList_, visitedNodes_, nextNodeId,
-                         nextColorIndex);
-    } else {
-      taskQueue->emplace(*graph_, *colorList_, visitedNodes_, nextNodeId,
-                         colorIndex_);
     }
+    if (visitedStates_.visit(nextNodeId, nextColorIndex)) {
+      stack->push_back({nextNodeId, nextColorIndex});
+    }
+  }
+  return false;
+}
+
+template <class GraphT>
+bool searchPathInParallel(const GraphT& graph, const ColorList& colorList,
+                          Opt<unsigned> maxThreads) {
+  auto numThreads = maxThreads ? maxThreads.value() : getNumberOfCpus();
+  if (numThreads <= 1 || colorList.size() <= 1) {
+    return searchPathWithScratch(graph, colorList, nullptr);
+  }
+  for (auto color : colorList) {
+    if (graph.findNodesByColor(color).empty()) return false;
   }
 
-  return Status::CONTINUE;
+  return ParallelSearch<GraphT>(graph, colorList).run(numThreads);
 }
 
 }  // namespace
 
-bool hasPath(const Graph& graph, const ColorList& colorList) {
-  using Status = HasPathTask::Status;
+void HasPathScratch::reset(std::size_t numNodes, std::size_t numColorIndexes,
+                           bool trackParents) {
+  numColorIndexes_ = numColorIndexes;
+  auto numStates = numNodes * numColorIndexes;
+  visitedStates_.assign((numStates + BITS_PER_WORD - 1) / BITS_PER_WORD, 0);
+  if (trackParents) {
+    parents_.assign(numStates, NO_PARENT);
+  } else {
+    parents_.clear();
+  }
+  frontier_.clear();
+  nextFrontier_.clear();
+}
+
+bool HasPathScratch::visit(NodeId nodeId, ColorIndex colorIndex) {
+  assert(colorIndex < numColorIndexes_);
+  auto stateId = nodeId * numColorIndexes_ + colorIndex;
+  auto& word = visitedStates_[stateId / BITS_PER_WORD];
+  auto mask = std::uint64_t(1) << (stateId % BITS_PER_WORD);
+  if (word & mask) {
+    return false;
+  }
+  word |= mask;
+  return true;
+}
+
+void HasPathScratch::setParent(const State& state, const State& parent) {
+  parents_[state.nodeId * numColorIndexes_ + state.colorIndex] =
+      parent.nodeId * numColorIndexes_ + parent.colorIndex;
+}
 
-  auto taskQueue = Queue<HasPathTask>();
-  auto status = HasPathTask::start(graph, colorList, &taskQueue);
-  while (status == Status::CONTINUE  //
-         && !taskQueue.empty()) {
-    auto task = std::move(taskQueue.top());
-    taskQueue.pop();
-    status = task.execute(&taskQueue);
+auto HasPathScratch::parentOf(const State& state) const -> Opt<State> {
+  if (parents_.empty()) {
+    return {};
+  }
+  auto parentId = parents_[state.nodeId * numColorIndexes_ + state.colorIndex];
+  if (parentId == NO_PARENT) {
+    return {};
   }
+  return State{parentId / numColorIndexes_, parentId % numColorIndexes_};
+}
+
+void HasPathScratch::swapFrontiers() {
+  std::swap(frontier_, nextFrontier_);
+  nextFrontier_.clear();
+}
+
+bool hasPath(const Graph& graph, const ColorList& colorList,
+             HasPathScratch* scratch, SearchStats* stats) {
+  return searchPathWithScratch(graph, colorList, scratch, stats);
+}
+
+bool hasPath(const FrozenGraph& graph, const ColorList& colorList,
+             HasPathScratch* scratch, SearchStats* stats) {
+  return searchPathWithScratch(graph, colorList, scratch, stats);
+}
+
+bool hasPath(const ConcurrentGraph::Snapshot& graph, const ColorList& colorList,
+             HasPathScratch* scratch, SearchStats* stats) {
+  return searchPathWithScratch(graph, colorList, scratch, stats);
+}
+
+bool hasPath(const Graph& graph, const ColorPattern& colorPattern,
+             HasPathScratch* scratch) {
+  return searchPatternWithScratch(graph, colorPattern, scratch);
+}
+
+bool hasPath(const FrozenGraph& graph, const ColorPattern& colorPattern,
+             HasPathScratch* scratch) {
+  return searchPatternWithScratch(graph, colorPattern, scratch);
+}
+
+bool hasPath(const ConcurrentGraph::Snapshot& graph,
+             const ColorPattern& colorPattern, HasPathScratch* scratch) {
+  return searchPatternWithScratch(graph, colorPattern, scratch);
+}
+
+auto findPath(const Graph& graph, const ColorList& colorList,
+              PathLength pathLength, HasPathScratch* scratch) -> NodeList {
+  return findPathWithScratch(graph, colorList, pathLength, scratch);
+}
+
+auto findPath(const FrozenGraph& graph, const ColorList& colorList,
+              PathLength pathLength, HasPathScratch* scratch) -> NodeList {
+  return findPathWithScratch(graph, colorList, pathLength, scratch);
+}
+
+bool hasPathInParallel(const Graph& graph, const ColorList& colorList,
+                       Opt<unsigned> maxThreads) {
+  return searchPathInParallel(graph, colorList, maxThreads);
+}
 
-  return bool(status == Status::SUCCESS);
+bool hasPathInParallel(const FrozenGraph& graph, const ColorList& colorList,
+                       Opt<unsigned> maxThreads) {
+  return searchPathInParallel(graph, colorList, maxThreads);
 }
 
 }  // namespace graph
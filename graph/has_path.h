@@ -1,9 +1,73 @@
 #pragma once
 
+#include <cstdint>
+#include <vector>
+
+#include "color_pattern.h"
+#include "concurrent_graph.h"
+#include "frozen_graph.h"
 #include "graph.h"
+#include "search_stats.h"
 
 namespace graph {
 
-bool hasPath(const Graph& graph, const ColorList& colorList);
+enum class PathLength { ANY, SHORTEST };
+
+class HasPathScratch {
+ public:
+  using ColorIndex = std::size_t;
+  using NodeId = Graph::NodeId;
+
+  struct State {
+    NodeId nodeId{};
+    ColorIndex colorIndex{};
+  };
+  using Frontier = std::vector<State>;
+
+  void reset(std::size_t numNodes, std::size_t numColorIndexes,
+             bool trackParents = false);
+  bool visit(NodeId nodeId, ColorIndex colorIndex);
+
+  void setParent(const State &state, const State &parent);
+  auto parentOf(const State &state) const -> Opt<State>;
+
+  auto frontier() -> Frontier & { return frontier_; }
+  auto nextFrontier() -> Frontier & { return nextFrontier_; }
+  void swapFrontiers();
+
+ private:
+  std::size_t numColorIndexes_{};
+  std::vector<std::uint64_t> visitedStates_{};
+  std::vector<std::size_t> parents_{};
+  Frontier frontier_{};
+  Frontier nextFrontier_{};
+};
+
+bool hasPath(const Graph &graph, const ColorList &colorList,
+             HasPathScratch *scratch = nullptr, SearchStats *stats = nullptr);
+bool hasPath(const FrozenGraph &graph, const ColorList &colorList,
+             HasPathScratch *scratch = nullptr, SearchStats *stats = nullptr);
+bool hasPath(const ConcurrentGraph::Snapshot &graph, const ColorList &colorList,
+             HasPathScratch *scratch = nullptr, SearchStats *stats = nullptr);
+
+bool hasPath(const Graph &graph, const ColorPattern &colorPattern,
+             HasPathScratch *scratch = nullptr);
+bool hasPath(const FrozenGraph &graph, const ColorPattern &colorPattern,
+             HasPathScratch *scratch = nullptr);
+bool hasPath(const ConcurrentGraph::Snapshot &graph,
+             const ColorPattern &colorPattern,
+             HasPathScratch *scratch = nullptr);
+
+auto findPath(const Graph &graph, const ColorList &colorList,
+              PathLength pathLength = PathLength::ANY,
+              HasPathScratch *scratch = nullptr) -> Graph::NodeList;
+auto findPath(const FrozenGraph &graph, const ColorList &colorList,
+              PathLength pathLength = PathLength::ANY,
+              HasPathScratch *scratch = nullptr) -> Graph::NodeList;
+
+bool hasPathInParallel(const Graph &graph, const ColorList &colorList,
+                       Opt<unsigned> maxThreads = {});
+bool hasPathInParallel(const FrozenGraph &graph, const ColorList &colorList,
+                       Opt<unsigned> maxThreads = {});
 
 }  // namespace graph
@@ -1,6 +1,7 @@
 
 #include <gtest/gtest.h>
 
+#include "graph_generators.h"
 #include "has_path.h"
 
 namespace graph {
@@ -22,6 +23,25 @@ struct GraphTest_TestCase {
   ExpectedResult expectedResult{};
 };
 
+bool isMatchingPath(const Graph &graph, const ColorList &colorList,
+                    const Graph::NodeList &path) {
+  if (path.empty() || colorList.empty() ||
+      graph.colorOf(path.front()) != colorList.front()) {
+    return false;
+  }
+  auto colorIndex = std::size_t(1);
+  for (auto i = std::size_t(1); i < path.size(); i++) {
+    if (colorIndex == colorList.size() ||
+        !graph.findNodesBySource(path[i - 1]).count(path[i])) {
+      return false;
+    }
+    if (graph.colorOf(path[i]) == colorList[colorIndex]) {
+      colorIndex++;
+    }
+  }
+  return colorIndex == colorList.size();
+}
+
 }  // namespace
 
 class TestHasPath : public ::testing::TestWithParam<GraphTest_TestCase> {
@@ -218,6 +238,72 @@ TEST_P(TestHasPath, testHasPath) {
   EXPECT_EQ(testCase.expectedResult, hasPath(graph, testCase.colorList));
 }
 
+TEST_P(TestHasPath, testHasPathFrozen) {
+  const auto &testCase = GetParam();
+
+  auto graph = createGraph().freeze();
+  EXPECT_EQ(testCase.expectedResult, hasPath(graph, testCase.colorList));
+}
+
+TEST_P(TestHasPath, testHasPathReusingScratch) {
+  const auto &testCase = GetParam();
+
+  auto graph = createGraph();
+  auto frozenGraph = graph.freeze();
+  auto scratch = HasPathScratch();
+  for (auto i = 0; i < 2; i++) {
+    EXPECT_EQ(testCase.expectedResult,
+              hasPath(graph, testCase.colorList, &scratch));
+    EXPECT_EQ(testCase.expectedResult,
+              hasPath(frozenGraph, testCase.colorList, &scratch));
+  }
+}
+
+TEST_P(TestHasPath, testHasPathWithStats) {
+  const auto &testCase = GetParam();
+
+  auto graph = createGraph();
+  auto stats = SearchStats();
+  EXPECT_EQ(testCase.expectedResult,
+            hasPath(graph, testCase.colorList, nullptr, &stats));
+  EXPECT_EQ(testCase.expectedResult, stats.outcome == SearchOutcome::FOUND);
+  EXPECT_LE(stats.visitedStates,
+            graph.numNodes() * testCase.colorList.size());
+  EXPECT_LE(stats.nodesExpanded, stats.visitedStates);
+  EXPECT_LE(stats.peakQueueSize, stats.visitedStates);
+}
+
+TEST_P(TestHasPath, testHasPathInParallel) {
+  const auto &testCase = GetParam();
+
+  auto graph = createGraph();
+  constexpr auto FOUR_THREADS = 4;
+  EXPECT_EQ(testCase.expectedResult,
+            hasPathInParallel(graph, testCase.colorList, FOUR_THREADS));
+}
+
+TEST_P(TestHasPath, testFindPath) {
+  const auto &testCase = GetParam();
+
+  auto graph = createGraph();
+  auto frozenGraph = graph.freeze();
+  auto scratch = HasPathScratch();
+  for (auto pathLength : {PathLength::ANY, PathLength::SHORTEST}) {
+    auto path = findPath(graph, testCase.colorList, pathLength, &scratch);
+    auto frozenPath =
+        findPath(frozenGraph, testCase.colorList, pathLength, &scratch);
+    EXPECT_EQ(testCase.expectedResult, !path.empty());
+    EXPECT_EQ(testCase.expectedResult, !frozenPath.empty());
+    if (testCase.expectedResult) {
+      EXPECT_TRUE(isMatchingPath(graph, testCase.colorList, path));
+      EXPECT_TRUE(isMatchingPath(graph, testCase.colorList, frozenPath));
+    }
+    if (pathLength == PathLength::SHORTEST) {
+      EXPECT_EQ(path.size(), frozenPath.size());
+    }
+  }
+}
+
 auto TestHasPath::getTestName(
     const ::testing::TestParamInfo<TestCase> &testInfo) -> std::string {
   const auto &testCase = testInfo.param;
@@ -258,4 +344,161 @@ auto TestHasPath::createGraph() const -> Graph {
   return graph;
 }
 
+// --- TestHasPath_Stats ---
+
+TEST(TestHasPath_Stats, testStats) {
+  auto graph = Graph();
+  auto red = graph.addNode(Color::Red);
+  auto green = graph.addNode(Color::Green);
+  auto blue = graph.addNode(Color::Blue);
+  graph.addEdge(red, green);
+  graph.addEdge(green, blue);
+
+  auto stats = SearchStats();
+  EXPECT_TRUE(hasPath(graph, {Color::Red, Color::Blue}, nullptr, &stats));
+  EXPECT_EQ(SearchOutcome::FOUND, stats.outcome);
+  EXPECT_EQ(2, stats.nodesExpanded);
+  EXPECT_EQ(2, stats.edgesScanned);
+  EXPECT_EQ(2, stats.visitedStates);
+  EXPECT_EQ(2, stats.peakQueueSize);
+
+  EXPECT_FALSE(hasPath(graph, {Color::Blue, Color::Red}, nullptr, &stats));
+  EXPECT_EQ(SearchOutcome::EXHAUSTED, stats.outcome);
+  EXPECT_EQ(1, stats.nodesExpanded);
+  EXPECT_EQ(0, stats.edgesScanned);
+
+  EXPECT_FALSE(hasPath(graph, {Color::Red, Color::Orange}, nullptr, &stats));
+  EXPECT_EQ(SearchOutcome::EARLY_FAIL, stats.outcome);
+  EXPECT_EQ(0, stats.nodesExpanded);
+}
+
+// --- TestHasPathInParallel ---
+
+using NumNodes = std::size_t;
+using MaxThreads = unsigned int;
+using TestCase_Parallel = std::tuple<NumNodes, MaxThreads>;
+
+class TestHasPathInParallel
+    : public ::testing::TestWithParam<TestCase_Parallel> {
+ public:
+  using TestCase = TestCase_Parallel;
+
+  static auto getTestName(const ::testing::TestParamInfo<TestCase> &testInfo)
+      -> std::string;
+};
+
+INSTANTIATE_TEST_SUITE_P(
+    TestHasPathInParallel, TestHasPathInParallel,
+    ::testing::Combine(::testing::Values(10, 100, 1'000, 10'000),
+                       ::testing::Values(1, 2, 4, 8, 16)),
+    &TestHasPathInParallel::getTestName);
+
+TEST_P(TestHasPathInParallel, testParallel) {
+  constexpr auto NUM_COLOR_LISTS = 50;
+  constexpr auto MAX_COLOR_LIST_SIZE = 6;
+
+  const auto &param = GetParam();
+  auto numNodes = std::get<0>(param);
+  auto maxThreads = std::get<1>(param);
+
+  auto randomGenerator = RandomGenerator(4242);
+  auto graph = createRandomGraph(numNodes, numNodes, &randomGenerator);
+  auto frozenGraph = graph.freeze();
+
+  for (auto i = 0; i < NUM_COLOR_LISTS; i++) {
+    auto colorList =
+        createRandomColorList(i % MAX_COLOR_LIST_SIZE, &randomGenerator);
+    auto expectedResult = hasPath(graph, colorList);
+    EXPECT_EQ(expectedResult, hasPathInParallel(graph, colorList, maxThreads))
+        << "colorList: " << toString(colorList);
+    EXPECT_EQ(expectedResult,
+              hasPathInParallel(frozenGraph, colorList, maxThreads))
+        << "colorList: " << toString(colorList);
+  }
+}
+
+auto TestHasPathInParallel::getTestName(
+    const ::testing::TestParamInfo<TestCase> &testInfo) -> std::string {
+  auto numNodes = std::get<0>(testInfo.param);
+  auto maxThreads = std::get<1>(testInfo.param);
+  return "numNodes_" + std::to_string(numNodes) + "_maxThreads_" +
+         std::to_string(maxThreads);
+}
+
+// --- TestFindPath ---
+
+class TestFindPath : public ::testing::TestWithParam<std::size_t> {
+ protected:
+  static constexpr auto MAX_PATH_EDGES = std::size_t(6);
+
+  static auto findShortestPathSize(const Graph &graph,
+                                   const ColorList &colorList)
+      -> Opt<std::size_t>;
+};
+
+INSTANTIATE_TEST_SUITE_P(TestFindPath, TestFindPath,
+                         ::testing::Values(4, 6, 8, 10));
+
+TEST_P(TestFindPath, testFindPath) {
+  constexpr auto NUM_COLOR_LISTS = 200;
+  constexpr auto MAX_COLOR_LIST_SIZE = 4;
+
+  auto numNodes = GetParam();
+  auto randomGenerator = RandomGenerator(4242);
+  auto graph = createRandomGraph(numNodes, 2 * numNodes, &randomGenerator);
+
+  auto scratch = HasPathScratch();
+  for (auto i = 0; i < NUM_COLOR_LISTS; i++) {
+    auto colorList =
+        createRandomColorList(1 + i % MAX_COLOR_LIST_SIZE, &randomGenerator);
+    auto expectedSize = findShortestPathSize(graph, colorList);
+
+    auto anyPath = findPath(graph, colorList, PathLength::ANY, &scratch);
+    auto shortestPath =
+        findPath(graph, colorList, PathLength::SHORTEST, &scratch);
+    EXPECT_EQ(hasPath(graph, colorList), !anyPath.empty())
+        << "colorList: " << toString(colorList);
+    EXPECT_EQ(anyPath.empty(), shortestPath.empty())
+        << "colorList: " << toString(colorList);
+    if (anyPath.empty()) {
+      EXPECT_FALSE(expectedSize) << "colorList: " << toString(colorList);
+      continue;
+    }
+
+    EXPECT_TRUE(isMatchingPath(graph, colorList, anyPath))
+        << "colorList: " << toString(colorList);
+    EXPECT_TRUE(isMatchingPath(graph, colorList, shortestPath))
+        << "colorList: " << toString(colorList);
+    EXPECT_LE(shortestPath.size(), anyPath.size());
+    if (expectedSize || shortestPath.size() <= MAX_PATH_EDGES + 1) {
+      EXPECT_EQ(expectedSize, shortestPath.size())
+          << "colorList: " << toString(colorList);
+    }
+  }
+}
+
+auto TestFindPath::findShortestPathSize(const Graph &graph,
+                                        const ColorList &colorList)
+    -> Opt<std::size_t> {
+  auto paths = std::vector<Graph::NodeList>();
+  for (auto nodeId : graph.findNodesByColor(colorList.front())) {
+    paths.push_back({nodeId});
+  }
+  for (auto numEdges = std::size_t(); numEdges <= MAX_PATH_EDGES;
+       numEdges++) {
+    auto nextPaths = std::vector<Graph::NodeList>();
+    for (const auto &path : paths) {
+      if (isMatchingPath(graph, colorList, path)) {
+        return path.size();
+      }
+      for (auto nextNodeId : graph.findNodesBySource(path.back())) {
+        nextPaths.push_back(path);
+        nextPaths.back().push_back(nextNodeId);
+      }
+    }
+    paths = std::move(nextPaths);
+  }
+  return {};
+}
+
 }  // namespace graph
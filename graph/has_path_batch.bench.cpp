@@ -0,0 +1,71 @@
+
+#include <benchmark/benchmark.h>
+
+#include "graph_generators.h"
+#include "has_path.h"
+#include "has_path_batch.h"
+
+namespace {
+
+constexpr auto NUM_NODES = std::size_t(10'000);
+constexpr auto NUM_EDGES = std::size_t(30'000);
+constexpr auto NUM_PREFIXES = std::size_t(8);
+constexpr auto PREFIX_SIZE = std::size_t(3);
+constexpr auto SUFFIX_SIZE = std::size_t(2);
+
+auto createColorLists(std::size_t numColorLists,
+                      graph::RandomGenerator *randomGenerator)
+    -> std::vector<graph::ColorList> {
+  auto prefixes = std::vector<graph::ColorList>();
+  for (auto i = std::size_t(); i < NUM_PREFIXES; i++) {
+    prefixes.emplace_back(
+        graph::createRandomColorList(PREFIX_SIZE, randomGenerator));
+  }
+
+  auto colorLists = std::vector<graph::ColorList>();
+  for (auto i = std::size_t(); i < numColorLists; i++) {
+    auto colorList = prefixes[i % NUM_PREFIXES];
+    auto suffix = graph::createRandomColorList(SUFFIX_SIZE, randomGenerator);
+    for (auto color : suffix) {
+      colorList.push_back(color);
+    }
+    colorLists.emplace_back(std::move(colorList));
+  }
+  return colorLists;
+}
+
+void BM_HasPathLoop(benchmark::State &state) {
+  auto randomGenerator = graph::RandomGenerator(4242);
+  auto graph =
+      graph::createRandomGraph(NUM_NODES, NUM_EDGES, &randomGenerator);
+  auto colorLists = createColorLists(state.range(0), &randomGenerator);
+  auto scratch = graph::HasPathScratch();
+  for (auto _ : state) {
+    for (const auto &colorList : colorLists) {
+      benchmark::DoNotOptimize(graph::hasPath(graph, colorList, &scratch));
+    }
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+void BM_HasPathBatch(benchmark::State &state) {
+  auto randomGenerator = graph::RandomGenerator(4242);
+  auto graph =
+      graph::createRandomGraph(NUM_NODES, NUM_EDGES, &randomGenerator);
+  auto colorLists = createColorLists(state.range(0), &randomGenerator);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(graph::hasPathBatch(graph, colorLists));
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+}  // namespace
+
+BENCHMARK(BM_HasPathLoop)
+    ->RangeMultiplier(10)
+    ->Range(10, 10'000)
+    ->Complexity();
+BENCHMARK(BM_HasPathBatch)
+    ->RangeMultiplier(10)
+    ->Range(10, 10'000)
+    ->Complexity();
@@ -0,0 +1,170 @@
+#include "has_path_batch.h"
+
+#include <array>
+#include <cstdint>
+
+namespace graph {
+namespace {
+
+using NodeId = Graph::NodeId;
+using NodeList = std::vector<NodeId>;
+using QueryIndex = std::size_t;
+using TrieNodeIndex = std::size_t;
+
+constexpr auto BITS_PER_WORD = std::size_t(64);
+constexpr auto NO_TRIE_NODE = TrieNodeIndex(0);
+
+struct TrieNode {
+  std::array<TrieNodeIndex, NUM_COLORS> children{};
+  std::vector<QueryIndex> queries{};
+  bool hasChildren{};
+};
+
+class ColorListTrie {
+ public:
+  explicit ColorListTrie(const std::vector<ColorList>& colorLists);
+
+  auto root() const -> const TrieNode& { return trieNodes_.front(); }
+  auto at(TrieNodeIndex index) const -> const TrieNode& {
+    return trieNodes_[index];
+  }
+
+ private:
+  std::vector<TrieNode> trieNodes_{};
+};
+
+ColorListTrie::ColorListTrie(const std::vector<ColorList>& colorLists)
+    : trieNodes_(1) {
+  for (auto queryIndex = QueryIndex(); queryIndex < colorLists.size();
+       queryIndex++) {
+    auto trieNodeIndex = TrieNodeIndex();
+    for (auto color : colorLists[queryIndex]) {
+      auto colorIndex = std::size_t(color);
+      if (trieNodes_[trieNodeIndex].children[colorIndex] == NO_TRIE_NODE) {
+        trieNodes_[trieNodeIndex].children[colorIndex] = trieNodes_.size();
+        trieNodes_[trieNodeIndex].hasChildren = true;
+        trieNodes_.emplace_back();
+      }
+      trieNodeIndex = trieNodes_[trieNodeIndex].children[colorIndex];
+    }
+    trieNodes_[trieNodeIndex].queries.emplace_back(queryIndex);
+  }
+}
+
+template <class GraphT>
+class BatchSearch {
+ public:
+  BatchSearch(const GraphT& graph, const std::vector<ColorList>& colorLists);
+
+  auto run() -> std::vector<bool>;
+
+ private:
+  struct Step {
+    TrieNodeIndex trieNodeIndex{};
+    NodeList matchedNodes{};
+  };
+
+  const GraphT* graph_{};
+  ColorListTrie trie_;
+  std::vector<bool> results_{};
+  std::vector<std::uint64_t> reachedNodes_{};
+  NodeList stack_{};
+
+  void expand(const Step& step, std::vector<Step>* pendingSteps);
+  bool reach(NodeId nodeId);
+};
+
+template <class GraphT>
+BatchSearch<GraphT>::BatchSearch(const GraphT& graph,
+                                 const std::vector<ColorList>& colorLists)
+    : graph_(&graph), trie_(colorLists), results_(colorLists.size()) {}
+
+template <class GraphT>
+auto BatchSearch<GraphT>::run() -> std::vector<bool> {
+  auto pendingSteps = std::vector<Step>();
+  for (auto colorIndex = std::size_t(); colorIndex < NUM_COLORS;
+       colorIndex++) {
+    auto childIndex = trie_.root().children[colorIndex];
+    if (childIndex == NO_TRIE_NODE) continue;
+
+    const auto& nodeIds = graph_->findNodesByColor(Color(colorIndex));
+    if (nodeIds.empty()) continue;
+    pendingSteps.push_back(
+        {childIndex, NodeList(nodeIds.begin(), nodeIds.end())});
+  }
+
+  while (!pendingSteps.empty()) {
+    auto step = std::move(pendingSteps.back());
+    pendingSteps.pop_back();
+
+    const auto& trieNode = trie_.at(step.trieNodeIndex);
+    for (auto queryIndex : trieNode.queries) {
+      results_[queryIndex] = true;
+    }
+    if (trieNode.hasChildren) {
+      expand(step, &pendingSteps);
+    }
+  }
+
+  return std::move(results_);
+}
+
+template <class GraphT>
+void BatchSearch<GraphT>::expand(const Step& step,
+                                 std::vector<Step>* pendingSteps) {
+  const auto& trieNode = trie_.at(step.trieNodeIndex);
+
+  auto numWords = (graph_->numNodes() + BITS_PER_WORD - 1) / BITS_PER_WORD;
+  reachedNodes_.assign(numWords, 0);
+  auto nextMatchedNodes = std::array<NodeList, NUM_COLORS>();
+
+  stack_.assign(step.matchedNodes.begin(), step.matchedNodes.end());
+  while (!stack_.empty()) {
+    auto nodeId = stack_.back();
+    stack_.pop_back();
+
+    for (auto nextNodeId : graph_->findNodesBySource(nodeId)) {
+      if (!reach(nextNodeId)) continue;
+
+      auto colorIndex = std::size_t(graph_->colorOf(nextNodeId));
+      if (trieNode.children[colorIndex] != NO_TRIE_NODE) {
+        nextMatchedNodes[colorIndex].emplace_back(nextNodeId);
+      }
+      stack_.emplace_back(nextNodeId);
+    }
+  }
+
+  for (auto colorIndex = std::size_t(); colorIndex < NUM_COLORS;
+       colorIndex++) {
+    if (nextMatchedNodes[colorIndex].empty()) continue;
+    pendingSteps->push_back({trieNode.children[colorIndex],
+                             std::move(nextMatchedNodes[colorIndex])});
+  }
+}
+
+template <class GraphT>
+bool BatchSearch<GraphT>::reach(NodeId nodeId) {
+  auto& word = reachedNodes_[nodeId / BITS_PER_WORD];
+  auto mask = std::uint64_t(1) << (nodeId % BITS_PER_WORD);
+  if (word & mask) {
+    return false;
+  }
+  word |= mask;
+  return true;
+}
+
+}  // namespace
+
+auto hasPathBatch(const Graph& graph,
+                  const std::vector<ColorList>& colorLists)
+    -> std::vector<bool> {
+  return BatchSearch<Graph>(graph, colorLists).run();
+}
+
+auto hasPathBatch(const FrozenGraph& graph,
+                  const std::vector<ColorList>& colorLists)
+    -> std::vector<bool> {
+  return BatchSearch<FrozenGraph>(graph, colorLists).run();
+}
+
+}  // namespace graph
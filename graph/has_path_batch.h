@@ -0,0 +1,16 @@
+#pragma once
+
+#include <vector>
+
+#include "frozen_graph.h"
+#include "graph.h"
+
+namespace graph {
+
+auto hasPathBatch(const Graph &graph, const std::vector<ColorList> &colorLists)
+    -> std::vector<bool>;
+auto hasPathBatch(const FrozenGraph &graph,
+                  const std::vector<ColorList> &colorLists)
+    -> std::vector<bool>;
+
+}  // namespace graph
@@ -0,0 +1,62 @@
+
+#include <gtest/gtest.h>
+
+#include "graph_generators.h"
+#include "has_path.h"
+#include "has_path_batch.h"
+
+namespace graph {
+
+class TestHasPathBatch : public ::testing::TestWithParam<std::size_t> {
+ protected:
+  auto createColorLists(RandomGenerator *randomGenerator) const
+      -> std::vector<ColorList>;
+};
+
+INSTANTIATE_TEST_SUITE_P(TestHasPathBatch, TestHasPathBatch,
+                         ::testing::Values(0, 1, 10, 100, 1'000));
+
+TEST_P(TestHasPathBatch, testHasPathBatch) {
+  auto numNodes = GetParam();
+  auto randomGenerator = RandomGenerator(4242);
+  auto graph = createRandomGraph(numNodes, numNodes * 2, &randomGenerator);
+  auto frozenGraph = graph.freeze();
+  auto colorLists = createColorLists(&randomGenerator);
+
+  auto actualResults = hasPathBatch(graph, colorLists);
+  auto actualFrozenResults = hasPathBatch(frozenGraph, colorLists);
+  ASSERT_EQ(colorLists.size(), actualResults.size());
+  ASSERT_EQ(colorLists.size(), actualFrozenResults.size());
+
+  for (auto i = std::size_t(); i < colorLists.size(); i++) {
+    auto expectedResult = hasPath(graph, colorLists[i]);
+    EXPECT_EQ(expectedResult, actualResults[i])
+        << "colorList: " << toString(colorLists[i]);
+    EXPECT_EQ(expectedResult, actualFrozenResults[i])
+        << "colorList: " << toString(colorLists[i]);
+  }
+}
+
+auto TestHasPathBatch::createColorLists(RandomGenerator *randomGenerator) const
+    -> std::vector<ColorList> {
+  constexpr auto NUM_PREFIXES = 5;
+  constexpr auto NUM_COLOR_LISTS_PER_PREFIX = 20;
+
+  auto colorLists = std::vector<ColorList>{ColorList{}};
+  for (auto i = 0; i < NUM_PREFIXES; i++) {
+    auto prefix = createRandomColorList(1 + i % 3, randomGenerator);
+    for (auto j = 0; j < NUM_COLOR_LISTS_PER_PREFIX; j++) {
+      auto colorList = prefix;
+      auto suffix = createRandomColorList(j % 4, randomGenerator);
+      for (auto color : suffix) {
+        colorList.push_back(color);
+      }
+      colorLists.emplace_back(std::move(colorList));
+    }
+  }
+  colorLists.emplace_back(colorLists.back());
+
+  return colorLists;
+}
+
+}  // namespace graph
@@ -0,0 +1,104 @@
+#include "mapped_file.h"
+
+#include <stdexcept>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace graph {
+
+#ifdef _WIN32
+
+MappedFile::MappedFile(const std::string& path) {
+  auto fileHandle = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ,
+                                nullptr, OPEN_EXISTING,
+                                FILE_FLAG_RANDOM_ACCESS, nullptr);
+  if (fileHandle == INVALID_HANDLE_VALUE) {
+    throw std::runtime_error("Cannot open file: " + path);
+  }
+  fileHandle_ = fileHandle;
+
+  auto fileSize = LARGE_INTEGER();
+  if (!GetFileSizeEx(fileHandle, &fileSize)) {
+    CloseHandle(fileHandle);
+    throw std::runtime_error("Cannot read file size: " + path);
+  }
+  size_ = std::size_t(fileSize.QuadPart);
+  if (size_ == 0) {
+    return;
+  }
+
+  auto mappingHandle =
+      CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  if (!mappingHandle) {
+    CloseHandle(fileHandle);
+    throw std::runtime_error("Cannot map file: " + path);
+  }
+  mappingHandle_ = mappingHandle;
+
+  auto data = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+  if (!data) {
+    CloseHandle(mappingHandle);
+    CloseHandle(fileHandle);
+    throw std::runtime_error("Cannot map file: " + path);
+  }
+  data_ = static_cast<const std::byte*>(data);
+}
+
+MappedFile::~MappedFile() {
+  if (data_) {
+    UnmapViewOfFile(data_);
+  }
+  if (mappingHandle_) {
+    CloseHandle(mappingHandle_);
+  }
+  if (fileHandle_) {
+    CloseHandle(fileHandle_);
+  }
+}
+
+#else
+
+MappedFile::MappedFile(const std::string& path) {
+  fileDescriptor_ = open(path.c_str(), O_RDONLY);
+  if (fileDescriptor_ < 0) {
+    throw std::runtime_error("Cannot open file: " + path);
+  }
+
+  struct stat fileStatus {};
+  if (fstat(fileDescriptor_, &fileStatus) != 0) {
+    close(fileDescriptor_);
+    throw std::runtime_error("Cannot read file size: " + path);
+  }
+  size_ = std::size_t(fileStatus.st_size);
+  if (size_ == 0) {
+    return;
+  }
+
+  auto data = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fileDescriptor_, 0);
+  if (data == MAP_FAILED) {
+    close(fileDescriptor_);
+    throw std::runtime_error("Cannot map file: " + path);
+  }
+  data_ = static_cast<const std::byte*>(data);
+}
+
+MappedFile::~MappedFile() {
+  if (data_) {
+    munmap(const_cast<std::byte*>(data_), size_);
+  }
+  close(fileDescriptor_);
+}
+
+#endif
+
+}  // namespace graph
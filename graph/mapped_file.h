@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace graph {
+
+class MappedFile {
+ public:
+  explicit MappedFile(const std::string &path);
+  ~MappedFile();
+
+  MappedFile(const MappedFile &) = delete;
+  auto operator=(const MappedFile &) -> MappedFile & = delete;
+
+  auto data() const -> const std::byte * { return data_; }
+  auto size() const -> std::size_t { return size_; }
+
+ private:
+  const std::byte *data_{};
+  std::size_t size_{};
+#ifdef _WIN32
+  void *fileHandle_{};
+  void *mappingHandle_{};
+#else
+  int fileDescriptor_{-1};
+#endif
+};
+
+}  // namespace graph
@@ -0,0 +1,129 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+
+#include "are_connected.h"
+#include "graph_generators.h"
+#include "has_path.h"
+#include "partitioned_graph.h"
+
+namespace {
+
+constexpr auto NUM_QUERIES = std::size_t(16);
+constexpr auto NUM_PARTITIONS = std::size_t(8);
+constexpr auto COLOR_LIST_SIZE = std::size_t(5);
+
+using NodeId = graph::Graph::NodeId;
+
+auto createGraph(std::size_t numNodes, graph::RandomGenerator *randomGenerator)
+    -> graph::Graph {
+  auto numRows = std::size_t(std::sqrt(double(numNodes)));
+  return graph::createGridGraph(numRows, numNodes / numRows, randomGenerator);
+}
+
+void BM_AreConnected_SingleThread(benchmark::State &state) {
+  auto numNodes = std::size_t(state.range(0));
+  auto randomGenerator = graph::RandomGenerator(4242);
+  auto graph = createGraph(numNodes, &randomGenerator).freeze();
+
+  auto scratch = graph::AreConnectedScratch();
+  for (auto _ : state) {
+    for (auto i = std::size_t(); i < NUM_QUERIES; i++) {
+      benchmark::DoNotOptimize(graph::areConnected(
+          graph, NodeId(i), NodeId(numNodes - 1 - i), &scratch));
+    }
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+template <unsigned maxThreads>
+void BM_AreConnected_Partitioned(benchmark::State &state) {
+  auto numNodes = std::size_t(state.range(0));
+  auto randomGenerator = graph::RandomGenerator(4242);
+  auto graph = graph::PartitionedGraph(
+      createGraph(numNodes, &randomGenerator), NUM_PARTITIONS);
+
+  for (auto _ : state) {
+    for (auto i = std::size_t(); i < NUM_QUERIES; i++) {
+      benchmark::DoNotOptimize(graph.areConnected(
+          NodeId(i), NodeId(numNodes - 1 - i), maxThreads));
+    }
+  }
+  state.counters["edgeCutRatio"] = graph.edgeCutRatio();
+  state.SetComplexityN(state.range(0));
+}
+
+void BM_HasPath_SingleThread(benchmark::State &state) {
+  auto numNodes = std::size_t(state.range(0));
+  auto randomGenerator = graph::RandomGenerator(4242);
+  auto graph = createGraph(numNodes, &randomGenerator).freeze();
+  auto colorLists = std::vector<graph::ColorList>();
+  for (auto i = std::size_t(); i < NUM_QUERIES; i++) {
+    colorLists.push_back(
+        graph::createRandomColorList(COLOR_LIST_SIZE, &randomGenerator));
+  }
+
+  auto scratch = graph::HasPathScratch();
+  for (auto _ : state) {
+    for (const auto &colorList : colorLists) {
+      benchmark::DoNotOptimize(graph::hasPath(graph, colorList, &scratch));
+    }
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+template <unsigned maxThreads>
+void BM_HasPath_Partitioned(benchmark::State &state) {
+  auto numNodes = std::size_t(state.range(0));
+  auto randomGenerator = graph::RandomGenerator(4242);
+  auto graph = graph::PartitionedGraph(
+      createGraph(numNodes, &randomGenerator), NUM_PARTITIONS);
+  auto colorLists = std::vector<graph::ColorList>();
+  for (auto i = std::size_t(); i < NUM_QUERIES; i++) {
+    colorLists.push_back(
+        graph::createRandomColorList(COLOR_LIST_SIZE, &randomGenerator));
+  }
+
+  for (auto _ : state) {
+    for (const auto &colorList : colorLists) {
+      benchmark::DoNotOptimize(graph.hasPath(colorList, maxThreads));
+    }
+  }
+  state.counters["edgeCutRatio"] = graph.edgeCutRatio();
+  state.SetComplexityN(state.range(0));
+}
+
+}  // namespace
+
+BENCHMARK(BM_AreConnected_SingleThread)
+    ->RangeMultiplier(10)
+    ->Range(10'000, 1'000'000)
+    ->Complexity();
+BENCHMARK_TEMPLATE(BM_AreConnected_Partitioned, 1)
+    ->RangeMultiplier(10)
+    ->Range(10'000, 1'000'000)
+    ->Complexity();
+BENCHMARK_TEMPLATE(BM_AreConnected_Partitioned, 4)
+    ->RangeMultiplier(10)
+    ->Range(10'000, 1'000'000)
+    ->Complexity();
+BENCHMARK_TEMPLATE(BM_AreConnected_Partitioned, 8)
+    ->RangeMultiplier(10)
+    ->Range(10'000, 1'000'000)
+    ->Complexity();
+BENCHMARK(BM_HasPath_SingleThread)
+    ->RangeMultiplier(10)
+    ->Range(10'000, 1'000'000)
+    ->Complexity();
+BENCHMARK_TEMPLATE(BM_HasPath_Partitioned, 1)
+    ->RangeMultiplier(10)
+    ->Range(10'000, 1'000'000)
+    ->Complexity();
+BENCHMARK_TEMPLATE(BM_HasPath_Partitioned, 4)
+    ->RangeMultiplier(10)
+    ->Range(10'000, 1'000'000)
+    ->Complexity();
+BENCHMARK_TEMPLATE(BM_HasPath_Partitioned, 8)
+    ->RangeMultiplier(10)
+    ->Range(10'000, 1'000'000)
+    ->Complexity();
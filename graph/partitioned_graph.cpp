@@ -0,0 +1,316 @@
+#include "partitioned_graph.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+namespace graph {
+namespace {
+
+constexpr auto BITS_PER_WORD = std::size_t(64);
+constexpr auto SECOND_COLOR_INDEX = std::size_t(1);
+
+using NodeId = PartitionedGraph::NodeId;
+using NodeList = PartitionedGraph::NodeList;
+using PartitionId = PartitionedGraph::PartitionId;
+using ColorIndex = std::size_t;
+
+constexpr auto FOUND = std::numeric_limits<ColorIndex>::max();
+
+struct State {
+  NodeId nodeId{};
+  ColorIndex colorIndex{};
+};
+using States = std::vector<State>;
+
+auto getNumberOfCpus() -> unsigned {
+  return std::thread::hardware_concurrency();
+}
+
+class Barrier {
+ public:
+  explicit Barrier(std::size_t numThreads) : numThreads_(numThreads) {}
+
+  template <class Function>
+  void arriveAndWait(const Function& onCompletion);
+
+ private:
+  std::mutex mutex_{};
+  std::condition_variable allArrived_{};
+  std::size_t numThreads_{};
+  std::size_t numArrived_{};
+  std::size_t generation_{};
+};
+
+template <class Function>
+void Barrier::arriveAndWait(const Function& onCompletion) {
+  auto lock = std::unique_lock(mutex_);
+  auto generation = generation_;
+  if (++numArrived_ < numThreads_) {
+    allArrived_.wait(lock, [&]() { return generation_ != generation; });
+    return;
+  }
+  onCompletion();
+  numArrived_ = 0;
+  generation_++;
+  lock.unlock();
+  allArrived_.notify_all();
+}
+
+template <class Step>
+class BulkSynchronousSearch {
+ public:
+  BulkSynchronousSearch(const PartitionedGraph& graph,
+                        std::size_t numColorIndexes, const Step& step);
+
+  void addSeed(const State& state);
+  bool run(unsigned numThreads);
+
+ private:
+  struct Partition {
+    std::vector<std::uint64_t> visitedStates{};
+    States inbox{};
+    std::vector<States> outboxes{};
+    States stack{};
+  };
+
+  const PartitionedGraph* graph_{};
+  std::size_t numColorIndexes_{};
+  const Step* step_{};
+  std::vector<Partition> partitions_{};
+  std::atomic<bool> found_{};
+
+  void runSuperstep(PartitionId partitionId);
+  void receiveFrontier(PartitionId partitionId);
+  bool visit(Partition* partition, const State& state) const;
+};
+
+template <class Step>
+BulkSynchronousSearch<Step>::BulkSynchronousSearch(
+    const PartitionedGraph& graph, std::size_t numColorIndexes,
+    const Step& step)
+    : graph_(&graph),
+      numColorIndexes_(numColorIndexes),
+      step_(&step),
+      partitions_(graph.numPartitions()) {
+  for (auto partitionId = PartitionId(); partitionId < partitions_.size();
+       partitionId++) {
+    auto& partition = partitions_[partitionId];
+    auto numStates =
+        graph.findNodesByPartition(partitionId).size() * numColorIndexes;
+    partition.visitedStates.resize((numStates + BITS_PER_WORD - 1) /
+                                   BITS_PER_WORD);
+    partition.outboxes.resize(partitions_.size());
+  }
+}
+
+template <class Step>
+void BulkSynchronousSearch<Step>::addSeed(const State& state) {
+  partitions_[graph_->partitionOf(state.nodeId)].inbox.push_back(state);
+}
+
+template <class Step>
+bool BulkSynchronousSearch<Step>::run(unsigned numThreads) {
+  auto numPartitions = partitions_.size();
+  auto numWorkers = std::max<std::size_t>(
+      std::min<std::size_t>(numThreads, numPartitions), 1);
+  auto barrier = Barrier(numWorkers);
+  auto hasInbox = true;
+  auto runWorker = [&](std::size_t worker) {
+    while (true) {
+      for (auto partitionId = worker; partitionId < numPartitions;
+           partitionId += numWorkers) {
+        runSuperstep(PartitionId(partitionId));
+      }
+      barrier.arriveAndWait([]() {});
+      if (found_.load()) {
+        return;
+      }
+
+      for (auto partitionId = worker; partitionId < numPartitions;
+           partitionId += numWorkers) {
+        receiveFrontier(PartitionId(partitionId));
+      }
+      barrier.arriveAndWait([&]() {
+        hasInbox = std::any_of(partitions_.begin(), partitions_.end(),
+                               [](const Partition& partition) {
+                                 return !partition.inbox.empty();
+                               });
+      });
+      if (!hasInbox) {
+        return;
+      }
+    }
+  };
+
+  auto helpers = std::vector<std::thread>();
+  for (auto worker = std::size_t(1); worker < numWorkers; worker++) {
+    helpers.emplace_back(runWorker, worker);
+  }
+  runWorker(0);
+  for (auto& helper : helpers) {
+    helper.join();
+  }
+  return found_.load();
+}
+
+template <class Step>
+void BulkSynchronousSearch<Step>::runSuperstep(PartitionId partitionId) {
+  auto& partition = partitions_[partitionId];
+  for (const auto& state : partition.inbox) {
+    if (visit(&partition, state)) {
+      partition.stack.push_back(state);
+    }
+  }
+  partition.inbox.clear();
+
+  const auto& graph = graph_->graph();
+  while (!partition.stack.empty()) {
+    if (found_.load(std::memory_order_relaxed)) {
+      return;
+    }
+    auto state = partition.stack.back();
+    partition.stack.pop_back();
+    for (auto nextNodeId : graph.findNodesBySource(state.nodeId)) {
+      auto nextColorIndex = (*step_)(state, nextNodeId);
+      if (nextColorIndex == FOUND) {
+        found_.store(true);
+        return;
+      }
+      auto nextState = State{nextNodeId, nextColorIndex};
+      auto nextPartitionId = graph_->partitionOf(nextNodeId);
+      if (nextPartitionId != partitionId) {
+        partition.outboxes[nextPartitionId].push_back(nextState);
+      } else if (visit(&partition, nextState)) {
+        partition.stack.push_back(nextState);
+      }
+    }
+  }
+}
+
+template <class Step>
+void BulkSynchronousSearch<Step>::receiveFrontier(PartitionId partitionId) {
+  auto& inbox = partitions_[partitionId].inbox;
+  for (auto& partition : partitions_) {
+    auto& outbox = partition.outboxes[partitionId];
+    inbox.insert(inbox.end(), outbox.begin(), outbox.end());
+    outbox.clear();
+  }
+}
+
+template <class Step>
+bool BulkSynchronousSearch<Step>::visit(Partition* partition,
+                                        const State& state) const {
+  auto stateId =
+      graph_->localIndexOf(state.nodeId) * numColorIndexes_ + state.colorIndex;
+  auto& word = partition->visitedStates[stateId / BITS_PER_WORD];
+  auto mask = std::uint64_t(1) << (stateId % BITS_PER_WORD);
+  if (word & mask) {
+    return false;
+  }
+  word |= mask;
+  return true;
+}
+
+}  // namespace
+
+PartitionedGraph::PartitionedGraph(const Graph& graph,
+                                   std::size_t numPartitions)
+    : graph_(graph.freeze()) {
+  if (numPartitions == 0) {
+    throw std::runtime_error("Invalid number of partitions");
+  }
+
+  auto numNodes = graph_.numNodes();
+  auto partitionSize = (numNodes + numPartitions - 1) / numPartitions;
+  partitionIds_.resize(numNodes);
+  localIndexes_.resize(numNodes);
+  partitions_.resize(numPartitions);
+
+  auto isAssigned = std::vector<bool>(numNodes);
+  auto numAssigned = std::size_t();
+  auto queue = NodeList();
+  queue.reserve(numNodes);
+  auto assign = [&](NodeId nodeId) {
+    auto& partition = partitions_[numAssigned / partitionSize];
+    isAssigned[nodeId] = true;
+    partitionIds_[nodeId] = PartitionId(numAssigned / partitionSize);
+    localIndexes_[nodeId] = partition.size();
+    partition.push_back(nodeId);
+    queue.push_back(nodeId);
+    numAssigned++;
+  };
+
+  for (auto rootId = NodeId(); rootId < numNodes; rootId++) {
+    if (isAssigned[rootId]) continue;
+    assign(rootId);
+    for (auto next = queue.size() - 1; next < queue.size(); next++) {
+      auto nodeId = queue[next];
+      for (auto nextNodeId : graph_.findNodesBySource(nodeId)) {
+        if (!isAssigned[nextNodeId]) assign(nextNodeId);
+      }
+      for (auto nextNodeId : graph_.findNodesByDestination(nodeId)) {
+        if (!isAssigned[nextNodeId]) assign(nextNodeId);
+      }
+    }
+  }
+
+  for (auto nodeId = NodeId(); nodeId < numNodes; nodeId++) {
+    for (auto nextNodeId : graph_.findNodesBySource(nodeId)) {
+      if (partitionIds_[nodeId] != partitionIds_[nextNodeId]) {
+        numCutEdges_++;
+      }
+    }
+  }
+}
+
+auto PartitionedGraph::edgeCutRatio() const -> double {
+  auto numEdges = graph_.numEdges();
+  return numEdges > 0 ? double(numCutEdges_) / double(numEdges) : 0.0;
+}
+
+bool PartitionedGraph::areConnected(NodeId source, NodeId destination,
+                                    Opt<unsigned> maxThreads) const {
+  auto numNodes = graph_.numNodes();
+  if (source >= numNodes || destination >= numNodes) return false;
+
+  auto step = [destination](const State&, NodeId nextNodeId) {
+    return nextNodeId == destination ? FOUND : ColorIndex();
+  };
+  auto search = BulkSynchronousSearch<decltype(step)>(*this, 1, step);
+  search.addSeed({source, ColorIndex()});
+  return search.run(maxThreads ? maxThreads.value() : getNumberOfCpus());
+}
+
+bool PartitionedGraph::hasPath(const ColorList& colorList,
+                               Opt<unsigned> maxThreads) const {
+  if (colorList.empty()) return false;
+  for (auto color : colorList) {
+    if (graph_.findNodesByColor(color).empty()) return false;
+  }
+  if (colorList.size() == 1) return true;
+
+  auto step = [this, &colorList](const State& state, NodeId nextNodeId) {
+    auto nextColorIndex = state.colorIndex;
+    if (graph_.colorOf(nextNodeId) == colorList[nextColorIndex]) {
+      nextColorIndex++;
+      if (nextColorIndex == colorList.size()) {
+        return FOUND;
+      }
+    }
+    return nextColorIndex;
+  };
+  auto search =
+      BulkSynchronousSearch<decltype(step)>(*this, colorList.size(), step);
+  for (auto nodeId : graph_.findNodesByColor(colorList.front())) {
+    search.addSeed({nodeId, SECOND_COLOR_INDEX});
+  }
+  return search.run(maxThreads ? maxThreads.value() : getNumberOfCpus());
+}
+
+}  // namespace graph
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "color.h"
+#include "frozen_graph.h"
+#include "graph.h"
+
+namespace graph {
+
+class PartitionedGraph {
+ public:
+  using NodeId = Graph::NodeId;
+  using NodeList = Graph::NodeList;
+  using PartitionId = std::uint32_t;
+
+  PartitionedGraph(const Graph &graph, std::size_t numPartitions);
+
+  auto graph() const -> const FrozenGraph & { return graph_; }
+  auto numPartitions() const -> std::size_t { return partitions_.size(); }
+  auto partitionOf(NodeId nodeId) const -> PartitionId {
+    return partitionIds_[nodeId];
+  }
+  auto localIndexOf(NodeId nodeId) const -> std::size_t {
+    return localIndexes_[nodeId];
+  }
+  auto findNodesByPartition(PartitionId partitionId) const
+      -> const NodeList & {
+    return partitions_[partitionId];
+  }
+
+  auto numCutEdges() const -> std::size_t { return numCutEdges_; }
+  auto edgeCutRatio() const -> double;
+
+  bool areConnected(NodeId source, NodeId destination,
+                    Opt<unsigned> maxThreads = {}) const;
+  bool hasPath(const ColorList &colorList,
+               Opt<unsigned> maxThreads = {}) const;
+
+ private:
+  FrozenGraph graph_{};
+  std::vector<PartitionId> partitionIds_{};
+  std::vector<std::size_t> localIndexes_{};
+  std::vector<NodeList> partitions_{};
+  std::size_t numCutEdges_{};
+};
+
+}  // namespace graph
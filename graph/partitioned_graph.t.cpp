@@ -0,0 +1,130 @@
+#include <gtest/gtest.h>
+
+#include <tuple>
+
+#include "are_connected.h"
+#include "graph_generators.h"
+#include "has_path.h"
+#include "partitioned_graph.h"
+
+namespace graph {
+
+using NodeId = PartitionedGraph::NodeId;
+using PartitionId = PartitionedGraph::PartitionId;
+
+// --- TestPartitionedGraph ---
+
+class TestPartitionedGraph
+    : public ::testing::TestWithParam<
+          std::tuple<std::size_t, std::size_t, unsigned>> {
+ public:
+  static auto getTestName(const ::testing::TestParamInfo<ParamType> &testInfo)
+      -> std::string {
+    auto [numNodes, numPartitions, maxThreads] = testInfo.param;
+    return "numNodes_" + std::to_string(numNodes) + "_numPartitions_" +
+           std::to_string(numPartitions) + "_maxThreads_" +
+           std::to_string(maxThreads);
+  }
+};
+
+INSTANTIATE_TEST_SUITE_P(
+    TestPartitionedGraph, TestPartitionedGraph,
+    ::testing::Combine(::testing::Values(1, 10, 100, 1'000),
+                       ::testing::Values(1, 3, 8), ::testing::Values(1, 4)),
+    &TestPartitionedGraph::getTestName);
+
+TEST_P(TestPartitionedGraph, testPartitions) {
+  auto [numNodes, numPartitions, maxThreads] = GetParam();
+  auto randomGenerator = RandomGenerator(4242);
+  auto graph = createRandomGraph(numNodes, 2 * numNodes, &randomGenerator);
+  auto partitionedGraph = PartitionedGraph(graph, numPartitions);
+
+  ASSERT_EQ(numPartitions, partitionedGraph.numPartitions());
+  auto maxPartitionSize = (numNodes + numPartitions - 1) / numPartitions;
+  auto numPartitionedNodes = std::size_t();
+  for (auto partitionId = PartitionId(); partitionId < numPartitions;
+       partitionId++) {
+    const auto &nodeIds = partitionedGraph.findNodesByPartition(partitionId);
+    EXPECT_LE(nodeIds.size(), maxPartitionSize);
+    for (auto localIndex = std::size_t(); localIndex < nodeIds.size();
+         localIndex++) {
+      EXPECT_EQ(partitionId, partitionedGraph.partitionOf(nodeIds[localIndex]));
+      EXPECT_EQ(localIndex, partitionedGraph.localIndexOf(nodeIds[localIndex]));
+    }
+    numPartitionedNodes += nodeIds.size();
+  }
+  EXPECT_EQ(numNodes, numPartitionedNodes);
+
+  auto numCutEdges = std::size_t();
+  for (auto nodeId = NodeId(); nodeId < numNodes; nodeId++) {
+    for (auto nextNodeId : graph.findNodesBySource(nodeId)) {
+      numCutEdges += partitionedGraph.partitionOf(nodeId) !=
+                     partitionedGraph.partitionOf(nextNodeId);
+    }
+  }
+  EXPECT_EQ(numCutEdges, partitionedGraph.numCutEdges());
+}
+
+TEST_P(TestPartitionedGraph, testSameAsSingleThread) {
+  constexpr auto NUM_QUERIES = 100;
+
+  auto [numNodes, numPartitions, maxThreads] = GetParam();
+  auto randomGenerator = RandomGenerator(4242);
+  auto graph = createRandomGraph(numNodes, numNodes, &randomGenerator);
+  auto partitionedGraph = PartitionedGraph(graph, numPartitions);
+
+  for (auto i = 0; i < NUM_QUERIES; i++) {
+    auto source = NodeId(randomGenerator() % numNodes);
+    auto destination = NodeId(randomGenerator() % numNodes);
+    EXPECT_EQ(areConnected(graph, source, destination),
+              partitionedGraph.areConnected(source, destination, maxThreads))
+        << source << " -> " << destination;
+
+    auto colorList = createRandomColorList(i % 5, &randomGenerator);
+    EXPECT_EQ(hasPath(graph, colorList),
+              partitionedGraph.hasPath(colorList, maxThreads))
+        << "colorList: " << toString(colorList);
+  }
+}
+
+TEST_P(TestPartitionedGraph, testAfterRemovals) {
+  constexpr auto NUM_QUERIES = 100;
+
+  auto [numNodes, numPartitions, maxThreads] = GetParam();
+  auto randomGenerator = RandomGenerator(4242);
+  auto graph = createRandomGraph(numNodes, numNodes, &randomGenerator);
+  for (auto i = std::size_t(); i < numNodes / 3; i++) {
+    auto nodeId = NodeId(randomGenerator() % numNodes);
+    if (graph.hasNode(nodeId)) {
+      graph.removeNode(nodeId);
+    }
+  }
+  auto partitionedGraph = PartitionedGraph(graph, numPartitions);
+
+  for (auto i = 0; i < NUM_QUERIES; i++) {
+    auto colorList = createRandomColorList(i % 5, &randomGenerator);
+    EXPECT_EQ(hasPath(graph, colorList),
+              partitionedGraph.hasPath(colorList, maxThreads))
+        << "colorList: " << toString(colorList);
+  }
+}
+
+// --- TestPartitionedGraph_Shapes ---
+
+TEST(TestPartitionedGraph_Shapes, testGridKeepsEdgesLocal) {
+  auto randomGenerator = RandomGenerator(4242);
+  auto graph = createGridGraph(100, 100, &randomGenerator);
+  auto partitionedGraph = PartitionedGraph(graph, 4);
+  EXPECT_GT(partitionedGraph.numCutEdges(), 0);
+  EXPECT_LT(partitionedGraph.edgeCutRatio(), 0.1);
+}
+
+TEST(TestPartitionedGraph_Shapes, testEmptyGraph) {
+  auto partitionedGraph = PartitionedGraph(Graph(), 4);
+  EXPECT_EQ(0.0, partitionedGraph.edgeCutRatio());
+  EXPECT_FALSE(partitionedGraph.areConnected(0, 0));
+  EXPECT_FALSE(partitionedGraph.hasPath({Color::Red}));
+  EXPECT_THROW(PartitionedGraph(Graph(), 0), std::runtime_error);
+}
+
+}  // namespace graph
@@ -0,0 +1,61 @@
+
+#include <benchmark/benchmark.h>
+
+#include "graph_generators.h"
+#include "reachability_index.h"
+
+namespace {
+
+constexpr auto NUM_QUERIES = std::size_t(1'024);
+constexpr auto EDGES_PER_NODE = std::size_t(2);
+
+void BM_ReachabilityIndexBuild(benchmark::State &state) {
+  auto numNodes = std::size_t(state.range(0));
+  auto randomGenerator = graph::RandomGenerator(4242);
+  auto graph = graph::createRandomGraph(
+      numNodes, numNodes * EDGES_PER_NODE, &randomGenerator);
+
+  auto memoryBytes = std::size_t();
+  for (auto _ : state) {
+    auto reachabilityIndex = graph::ReachabilityIndex(graph);
+    memoryBytes = reachabilityIndex.stats().memoryBytes;
+  }
+  state.counters["memoryBytes"] = double(memoryBytes);
+  state.SetComplexityN(state.range(0));
+}
+
+void BM_ReachabilityIndexQuery(benchmark::State &state) {
+  using NodeId = graph::Graph::NodeId;
+
+  auto numNodes = std::size_t(state.range(0));
+  auto randomGenerator = graph::RandomGenerator(4242);
+  auto graph = graph::createRandomGraph(
+      numNodes, numNodes * EDGES_PER_NODE, &randomGenerator);
+  auto reachabilityIndex = graph::ReachabilityIndex(graph);
+
+  auto queries = std::vector<std::pair<NodeId, NodeId>>();
+  for (auto i = std::size_t(); i < NUM_QUERIES; i++) {
+    queries.emplace_back(randomGenerator() % numNodes,
+                         randomGenerator() % numNodes);
+  }
+
+  auto scratch = graph::AreConnectedScratch();
+  for (auto _ : state) {
+    for (auto [source, destination] : queries) {
+      benchmark::DoNotOptimize(
+          reachabilityIndex.areConnected(source, destination, &scratch));
+    }
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+}  // namespace
+
+BENCHMARK(BM_ReachabilityIndexBuild)
+    ->RangeMultiplier(10)
+    ->Range(1'000, 1'000'000)
+    ->Complexity();
+BENCHMARK(BM_ReachabilityIndexQuery)
+    ->RangeMultiplier(10)
+    ->Range(1'000, 1'000'000)
+    ->Complexity();
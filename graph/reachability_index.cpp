@@ -0,0 +1,198 @@
+#include "reachability_index.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "strongly_connected_components.h"
+
+namespace graph {
+namespace {
+
+using ComponentId = ReachabilityIndex::ComponentId;
+using NodeId = Graph::NodeId;
+using Side = AreConnectedScratch::Side;
+
+template <class T>
+auto capacityBytes(const std::vector<T>& values) -> std::size_t {
+  return values.capacity() * sizeof(T);
+}
+
+auto capacityBytes(const std::vector<bool>& values) -> std::size_t {
+  return values.capacity() / 8;
+}
+
+}  // namespace
+
+ReachabilityIndex::ReachabilityIndex(const Graph& graph) {
+  auto startTime = std::chrono::steady_clock::now();
+
+  auto components = findStronglyConnectedComponents(graph);
+  componentIds_ = std::move(components.componentIds);
+  buildDag(components.condensation);
+  buildLabels();
+
+  stats_.buildTime = std::chrono::steady_clock::now() - startTime;
+  stats_.memoryBytes = capacityBytes(componentIds_) + capacityBytes(isCyclic_) +
+                       capacityBytes(dagOffsets_) + capacityBytes(dagTargets_) +
+                       capacityBytes(treeIntervals_) + capacityBytes(labels_);
+  stats_.numComponents = isCyclic_.size();
+  stats_.numDagEdges = dagTargets_.size();
+}
+
+bool ReachabilityIndex::areConnected(NodeId source, NodeId destination,
+                                     AreConnectedScratch* scratch) const {
+  if (source >= componentIds_.size() || destination >= componentIds_.size()) {
+    return false;
+  }
+
+  auto sourceComponent = componentIds_[source];
+  auto destinationComponent = componentIds_[destination];
+  if (sourceComponent == destinationComponent) {
+    return isCyclic_[sourceComponent];
+  }
+
+  if (scratch) {
+    return searchDag(sourceComponent, destinationComponent, scratch);
+  } else {
+    auto localScratch = AreConnectedScratch();
+    return searchDag(sourceComponent, destinationComponent, &localScratch);
+  }
+}
+
+void ReachabilityIndex::buildDag(const Graph& condensation) {
+  auto numComponents = condensation.numNodes();
+  isCyclic_.resize(numComponents);
+  dagOffsets_.reserve(numComponents + 1);
+  dagOffsets_.push_back(0);
+  for (auto componentId = ComponentId(); componentId < numComponents;
+       componentId++) {
+    auto first = dagTargets_.size();
+    for (auto nextComponentId : condensation.findNodesBySource(componentId)) {
+      if (nextComponentId == componentId) {
+        isCyclic_[componentId] = true;
+      } else {
+        dagTargets_.push_back(nextComponentId);
+      }
+    }
+    std::sort(dagTargets_.begin() + first, dagTargets_.end());
+    dagOffsets_.push_back(dagTargets_.size());
+  }
+}
+
+void ReachabilityIndex::buildLabels() {
+  struct Frame {
+    ComponentId componentId{};
+    std::size_t nextEdge{};
+  };
+
+  auto numComponents = isCyclic_.size();
+  treeIntervals_.resize(numComponents);
+  labels_.resize(numComponents);
+
+  auto frames = std::vector<Frame>();
+  for (auto labelIndex = std::size_t(); labelIndex < NUM_LABELS;
+       labelIndex++) {
+    auto isReversed = labelIndex % 2 == 1;
+    auto isVisited = std::vector<bool>(numComponents);
+    auto nextRank = std::size_t();
+
+    auto childAt = [&](ComponentId componentId, std::size_t edge) {
+      auto first = dagOffsets_[componentId];
+      auto last = dagOffsets_[componentId + 1];
+      return isReversed ? dagTargets_[last - 1 - edge]
+                        : dagTargets_[first + edge];
+    };
+    auto enter = [&](ComponentId componentId) {
+      isVisited[componentId] = true;
+      if (labelIndex == 0) {
+        treeIntervals_[componentId].low = nextRank;
+      }
+      frames.push_back({componentId, 0});
+    };
+
+    for (auto rootIndex = std::size_t(); rootIndex < numComponents;
+         rootIndex++) {
+      auto rootId = isReversed ? rootIndex : numComponents - 1 - rootIndex;
+      if (isVisited[rootId]) continue;
+
+      enter(rootId);
+      while (!frames.empty()) {
+        auto& frame = frames.back();
+        auto componentId = frame.componentId;
+        auto numEdges = dagOffsets_[componentId + 1] - dagOffsets_[componentId];
+        if (frame.nextEdge < numEdges) {
+          auto childId = childAt(componentId, frame.nextEdge);
+          frame.nextEdge++;
+          if (!isVisited[childId]) {
+            enter(childId);
+          }
+          continue;
+        }
+        frames.pop_back();
+
+        auto post = nextRank++;
+        auto low = post;
+        for (auto edge = dagOffsets_[componentId];
+             edge < dagOffsets_[componentId + 1]; edge++) {
+          low = std::min(low, labels_[dagTargets_[edge]][labelIndex].low);
+        }
+        labels_[componentId][labelIndex] = {low, post};
+        if (labelIndex == 0) {
+          treeIntervals_[componentId].post = post;
+        }
+      }
+    }
+  }
+}
+
+bool ReachabilityIndex::isTreeAncestor(ComponentId ancestor,
+                                       ComponentId descendant) const {
+  const auto& outer = treeIntervals_[ancestor];
+  const auto& inner = treeIntervals_[descendant];
+  return outer.low <= inner.low && inner.post <= outer.post;
+}
+
+bool ReachabilityIndex::mayReach(ComponentId source,
+                                 ComponentId destination) const {
+  if (source < destination) {
+    return false;
+  }
+  for (auto labelIndex = std::size_t(); labelIndex < NUM_LABELS;
+       labelIndex++) {
+    const auto& outer = labels_[source][labelIndex];
+    const auto& inner = labels_[destination][labelIndex];
+    if (inner.low < outer.low || outer.post < inner.post) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool ReachabilityIndex::searchDag(ComponentId source, ComponentId destination,
+                                  AreConnectedScratch* scratch) const {
+  if (isTreeAncestor(source, destination)) return true;
+  if (!mayReach(source, destination)) return false;
+
+  scratch->reset(isCyclic_.size());
+  auto& stack = scratch->frontier(Side::FORWARD);
+  stack.push_back(source);
+  scratch->visit(Side::FORWARD, source);
+
+  while (!stack.empty()) {
+    auto componentId = stack.back();
+    stack.pop_back();
+    for (auto edge = dagOffsets_[componentId];
+         edge < dagOffsets_[componentId + 1]; edge++) {
+      auto childId = dagTargets_[edge];
+      if (!scratch->visit(Side::FORWARD, childId)) continue;
+      if (isTreeAncestor(childId, destination)) return true;
+      if (mayReach(childId, destination)) {
+        stack.push_back(childId);
+      }
+    }
+  }
+
+  return false;
+}
+
+}  // namespace graph
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <vector>
+
+#include "are_connected.h"
+#include "graph.h"
+
+namespace graph {
+
+class ReachabilityIndex {
+ public:
+  using NodeId = Graph::NodeId;
+  using ComponentId = std::size_t;
+
+  struct Stats {
+    std::chrono::nanoseconds buildTime{};
+    std::size_t memoryBytes{};
+    std::size_t numComponents{};
+    std::size_t numDagEdges{};
+  };
+
+  explicit ReachabilityIndex(const Graph &graph);
+
+  bool areConnected(NodeId source, NodeId destination,
+                    AreConnectedScratch *scratch = nullptr) const;
+  auto stats() const -> const Stats & { return stats_; }
+
+ private:
+  static constexpr auto NUM_LABELS = std::size_t(2);
+
+  struct Interval {
+    std::size_t low{};
+    std::size_t post{};
+  };
+  using Labels = std::array<Interval, NUM_LABELS>;
+
+  std::vector<ComponentId> componentIds_{};
+  std::vector<bool> isCyclic_{};
+  std::vector<std::size_t> dagOffsets_{};
+  std::vector<ComponentId> dagTargets_{};
+  std::vector<Interval> treeIntervals_{};
+  std::vector<Labels> labels_{};
+  Stats stats_{};
+
+  void buildDag(const Graph &condensation);
+  void buildLabels();
+
+  bool isTreeAncestor(ComponentId ancestor, ComponentId descendant) const;
+  bool mayReach(ComponentId source, ComponentId destination) const;
+  bool searchDag(ComponentId source, ComponentId destination,
+                 AreConnectedScratch *scratch) const;
+};
+
+}  // namespace graph
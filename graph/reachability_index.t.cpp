@@ -0,0 +1,92 @@
+
+#include <gtest/gtest.h>
+
+#include "are_connected.h"
+#include "graph_generators.h"
+#include "reachability_index.h"
+
+namespace graph {
+
+using NodeId = Graph::NodeId;
+
+// --- TestReachabilityIndex ---
+
+using NumNodes = std::size_t;
+using EdgesPerNode = std::size_t;
+using TestCase_ReachabilityIndex = std::tuple<NumNodes, EdgesPerNode>;
+
+class TestReachabilityIndex
+    : public ::testing::TestWithParam<TestCase_ReachabilityIndex> {
+ public:
+  using TestCase = TestCase_ReachabilityIndex;
+
+  static auto getTestName(const ::testing::TestParamInfo<TestCase> &testInfo)
+      -> std::string;
+};
+
+INSTANTIATE_TEST_SUITE_P(
+    TestReachabilityIndex, TestReachabilityIndex,
+    ::testing::Combine(::testing::Values(1, 10, 100, 1'000),
+                       ::testing::Values(0, 1, 2, 4)),
+    &TestReachabilityIndex::getTestName);
+
+TEST_P(TestReachabilityIndex, testAreConnected) {
+  auto numNodes = std::get<0>(GetParam());
+  auto edgesPerNode = std::get<1>(GetParam());
+
+  auto randomGenerator = RandomGenerator(4242);
+  auto graph =
+      createRandomGraph(numNodes, numNodes * edgesPerNode, &randomGenerator);
+  auto reachabilityIndex = ReachabilityIndex(graph);
+  EXPECT_LE(reachabilityIndex.stats().numComponents, numNodes);
+  EXPECT_GT(reachabilityIndex.stats().memoryBytes, 0);
+
+  auto scratch = AreConnectedScratch();
+  for (auto source = NodeId(); source < numNodes; source += 1 + numNodes / 20) {
+    for (auto destination = NodeId(); destination < numNodes; destination++) {
+      EXPECT_EQ(areConnected(graph, source, destination),
+                reachabilityIndex.areConnected(source, destination, &scratch))
+          << source << " -> " << destination;
+    }
+  }
+}
+
+auto TestReachabilityIndex::getTestName(
+    const ::testing::TestParamInfo<TestCase> &testInfo) -> std::string {
+  auto numNodes = std::get<0>(testInfo.param);
+  auto edgesPerNode = std::get<1>(testInfo.param);
+  return "numNodes_" + std::to_string(numNodes) + "_edgesPerNode_" +
+         std::to_string(edgesPerNode);
+}
+
+// --- TestReachabilityIndex_Graph ---
+
+TEST(TestReachabilityIndex_Graph, testIndexIsDroppedOnUpdate) {
+  auto graph = Graph();
+  auto a = graph.addNode(Color::Red);
+  auto b = graph.addNode(Color::Green);
+  auto c = graph.addNode(Color::Blue);
+  graph.addEdge(a, b);
+
+  graph.buildReachabilityIndex();
+  ASSERT_NE(nullptr, graph.reachabilityIndex());
+  EXPECT_TRUE(graph.areConnected(a, b));
+  EXPECT_FALSE(graph.areConnected(a, c));
+
+  graph.addEdge(b, c);
+  EXPECT_EQ(nullptr, graph.reachabilityIndex());
+  EXPECT_TRUE(graph.areConnected(a, c));
+
+  graph.buildReachabilityIndex();
+  EXPECT_TRUE(graph.areConnected(a, c));
+  EXPECT_FALSE(graph.areConnected(c, a));
+
+  auto scratch = AreConnectedScratch();
+  EXPECT_TRUE(graph.areConnected(a, c, &scratch));
+  EXPECT_FALSE(graph.areConnected(c, a, &scratch));
+
+  graph.addNode(Color::White);
+  EXPECT_EQ(nullptr, graph.reachabilityIndex());
+}
+
+}  // namespace graph
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+
+namespace graph {
+
+enum class SearchOutcome { FOUND, EXHAUSTED, EARLY_FAIL };
+
+struct SearchStats {
+  std::size_t nodesExpanded{};
+  std::size_t edgesScanned{};
+  std::size_t peakQueueSize{};
+  std::size_t visitedStates{};
+  SearchOutcome outcome{};
+};
+
+template <bool ENABLED>
+class SearchStatsRecorder {
+ public:
+  explicit SearchStatsRecorder(SearchStats *stats) : stats_(stats) {
+    *stats_ = SearchStats();
+  }
+
+  void expandNode() { stats_->nodesExpanded++; }
+  void scanEdge() { stats_->edgesScanned++; }
+  void visitState() { stats_->visitedStates++; }
+  void updateQueueSize(std::size_t queueSize) {
+    stats_->peakQueueSize = std::max(stats_->peakQueueSize, queueSize);
+  }
+  void finish(SearchOutcome outcome) { stats_->outcome = outcome; }
+
+ private:
+  SearchStats *stats_{};
+};
+
+template <>
+class SearchStatsRecorder<false> {
+ public:
+  explicit SearchStatsRecorder(SearchStats *) {}
+
+  void expandNode() {}
+  void scanEdge() {}
+  void visitState() {}
+  void updateQueueSize(std::size_t) {}
+  void finish(SearchOutcome) {}
+};
+
+}  // namespace graph
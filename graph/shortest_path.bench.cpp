@@ -0,0 +1,63 @@
+#include <benchmark/benchmark.h>
+
+#include <type_traits>
+
+#include "graph_generators.h"
+#include "shortest_path.h"
+
+namespace {
+
+constexpr auto NUM_QUERIES = std::size_t(64);
+constexpr auto EDGES_PER_NODE = std::size_t(4);
+constexpr auto MAX_WEIGHT = std::size_t(100);
+
+template <class GraphT>
+auto createGraph(std::size_t numNodes, std::size_t numEdges,
+                 graph::RandomGenerator *randomGenerator) -> GraphT {
+  auto graph = graph::createRandomGraph(numNodes, 0, randomGenerator);
+  for (auto i = std::size_t(); i < numEdges; i++) {
+    graph.addEdge((*randomGenerator)() % numNodes,
+                  (*randomGenerator)() % numNodes,
+                  graph::Graph::Weight((*randomGenerator)() % MAX_WEIGHT));
+  }
+  if constexpr (std::is_same_v<GraphT, graph::FrozenGraph>) {
+    return graph.freeze();
+  } else {
+    return graph;
+  }
+}
+
+template <class GraphT>
+void BM_FindShortestPath(benchmark::State &state) {
+  auto numEdges = std::size_t(state.range(0));
+  auto numNodes = numEdges / EDGES_PER_NODE;
+  auto randomGenerator = graph::RandomGenerator(4242);
+  auto graph = createGraph<GraphT>(numNodes, numEdges, &randomGenerator);
+
+  using NodeId = graph::Graph::NodeId;
+  auto queries = std::vector<std::pair<NodeId, NodeId>>();
+  for (auto i = std::size_t(); i < NUM_QUERIES; i++) {
+    queries.emplace_back(randomGenerator() % numNodes,
+                         randomGenerator() % numNodes);
+  }
+
+  auto scratch = graph::ShortestPathScratch();
+  for (auto _ : state) {
+    for (auto [source, destination] : queries) {
+      benchmark::DoNotOptimize(
+          graph::findShortestPath(graph, source, destination, {}, &scratch));
+    }
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_FindShortestPath, graph::Graph)
+    ->RangeMultiplier(10)
+    ->Range(10'000, 1'000'000)
+    ->Complexity();
+BENCHMARK_TEMPLATE(BM_FindShortestPath, graph::FrozenGraph)
+    ->RangeMultiplier(10)
+    ->Range(10'000, 1'000'000)
+    ->Complexity();
@@ -0,0 +1,220 @@
+#include "shortest_path.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace graph {
+namespace {
+
+constexpr auto QUEUE_ARITY = std::size_t(4);
+
+using NodeId = Graph::NodeId;
+using Weight = Graph::Weight;
+using QueueItem = ShortestPathScratch::QueueItem;
+
+template <class Function>
+void forEachEdge(const Graph& graph, NodeId nodeId, const Function& function) {
+  const auto& nextNodeIds = graph.findNodesBySource(nodeId);
+  const auto& weights = graph.findWeightsBySource(nodeId);
+  if (weights.size() == nextNodeIds.size()) {
+    for (auto [nextNodeId, weight] : weights) {
+      function(nextNodeId, weight);
+    }
+    return;
+  }
+  for (auto nextNodeId : nextNodeIds) {
+    auto weightIt = weights.empty() ? weights.end() : weights.find(nextNodeId);
+    function(nextNodeId, weightIt != weights.end() ? weightIt->second : 1);
+  }
+}
+
+template <class Function>
+void forEachEdge(const FrozenGraph& graph, NodeId nodeId,
+                 const Function& function) {
+  auto nextNodeIds = graph.findNodesBySource(nodeId);
+  auto weights = graph.findWeightsBySource(nodeId);
+  for (auto i = std::size_t(); i < nextNodeIds.size(); i++) {
+    function(nextNodeIds.begin()[i], weights[i]);
+  }
+}
+
+template <bool USE_HEURISTIC, class GraphT>
+auto searchShortestPath(const GraphT& graph, NodeId source,
+                        NodeId destination, const Heuristic& heuristic,
+                        ShortestPathScratch* scratch) -> Opt<ShortestPath> {
+  auto numNodes = graph.numNodes();
+  if (source >= numNodes || destination >= numNodes) {
+    return {};
+  }
+
+  auto estimate = [&heuristic](NodeId nodeId) -> Weight {
+    if constexpr (USE_HEURISTIC) {
+      return heuristic(nodeId);
+    } else {
+      return 0;
+    }
+  };
+
+  scratch->reset(numNodes);
+  scratch->reach(source, 0, source);
+  scratch->push(estimate(source), source);
+
+  while (!scratch->isQueueEmpty()) {
+    auto nodeId = scratch->pop();
+    if (!scratch->settle(nodeId)) {
+      continue;
+    }
+
+    auto distance = scratch->distanceOf(nodeId);
+    if (nodeId == destination) {
+      auto shortestPath = ShortestPath{distance, {}};
+      for (; nodeId != source; nodeId = scratch->parentOf(nodeId)) {
+        shortestPath.path.push_back(nodeId);
+      }
+      shortestPath.path.push_back(source);
+      std::reverse(shortestPath.path.begin(), shortestPath.path.end());
+      return shortestPath;
+    }
+
+    forEachEdge(graph, nodeId, [&](NodeId nextNodeId, Weight weight) {
+      auto nextDistance = distance + weight;
+      if (scratch->isReached(nextNodeId) &&
+          scratch->distanceOf(nextNodeId) <= nextDistance) {
+        return;
+      }
+      scratch->reach(nextNodeId, nextDistance, nodeId);
+      scratch->push(nextDistance + estimate(nextNodeId), nextNodeId);
+    });
+  }
+
+  return {};
+}
+
+template <class GraphT>
+auto searchShortestPathWithHeuristic(const GraphT& graph, NodeId source,
+                                     NodeId destination,
+                                     const Heuristic& heuristic,
+                                     ShortestPathScratch* scratch)
+    -> Opt<ShortestPath> {
+  if (heuristic) {
+    return searchShortestPath<true>(graph, source, destination, heuristic,
+                                    scratch);
+  } else {
+    return searchShortestPath<false>(graph, source, destination, heuristic,
+                                     scratch);
+  }
+}
+
+template <class GraphT>
+auto searchShortestPathWithScratch(const GraphT& graph, NodeId source,
+                                   NodeId destination,
+                                   const Heuristic& heuristic,
+                                   ShortestPathScratch* scratch)
+    -> Opt<ShortestPath> {
+  if (scratch) {
+    return searchShortestPathWithHeuristic(graph, source, destination,
+                                           heuristic, scratch);
+  } else {
+    auto localScratch = ShortestPathScratch();
+    return searchShortestPathWithHeuristic(graph, source, destination,
+                                           heuristic, &localScratch);
+  }
+}
+
+}  // namespace
+
+void ShortestPathScratch::reset(std::size_t numNodes) {
+  epoch_++;
+  if (epoch_ == 0) {
+    reachEpochs_.assign(reachEpochs_.size(), 0);
+    settleEpochs_.assign(settleEpochs_.size(), 0);
+    epoch_++;
+  }
+  reachEpochs_.resize(numNodes);
+  settleEpochs_.resize(numNodes);
+  distances_.resize(numNodes);
+  parents_.resize(numNodes);
+  queue_.clear();
+}
+
+bool ShortestPathScratch::isReached(NodeId nodeId) const {
+  return reachEpochs_[nodeId] == epoch_;
+}
+
+void ShortestPathScratch::reach(NodeId nodeId, Weight distance,
+                                NodeId parent) {
+  reachEpochs_[nodeId] = epoch_;
+  distances_[nodeId] = distance;
+  parents_[nodeId] = parent;
+}
+
+bool ShortestPathScratch::settle(NodeId nodeId) {
+  auto& settleEpoch = settleEpochs_[nodeId];
+  if (settleEpoch == epoch_) {
+    return false;
+  }
+  settleEpoch = epoch_;
+  return true;
+}
+
+void ShortestPathScratch::push(Weight priority, NodeId nodeId) {
+  auto index = queue_.size();
+  queue_.push_back({priority, nodeId});
+  while (index > 0) {
+    auto parentIndex = (index - 1) / QUEUE_ARITY;
+    if (queue_[parentIndex].priority <= priority) {
+      break;
+    }
+    queue_[index] = queue_[parentIndex];
+    index = parentIndex;
+  }
+  queue_[index] = {priority, nodeId};
+}
+
+auto ShortestPathScratch::pop() -> NodeId {
+  auto nodeId = queue_.front().nodeId;
+  auto lastItem = queue_.back();
+  queue_.pop_back();
+  auto numItems = queue_.size();
+  if (numItems == 0) {
+    return nodeId;
+  }
+
+  auto index = std::size_t();
+  while (true) {
+    auto firstChild = index * QUEUE_ARITY + 1;
+    if (firstChild >= numItems) {
+      break;
+    }
+    auto lastChild = std::min(numItems, firstChild + QUEUE_ARITY);
+    auto bestChild = firstChild;
+    for (auto child = firstChild + 1; child < lastChild; child++) {
+      if (queue_[child].priority < queue_[bestChild].priority) {
+        bestChild = child;
+      }
+    }
+    if (lastItem.priority <= queue_[bestChild].priority) {
+      break;
+    }
+    queue_[index] = queue_[bestChild];
+    index = bestChild;
+  }
+  queue_[index] = lastItem;
+  return nodeId;
+}
+
+auto findShortestPath(const Graph& graph, NodeId source, NodeId destination,
+                      const Heuristic& heuristic,
+                      ShortestPathScratch* scratch) -> Opt<ShortestPath> {
+  return searchShortestPathWithScratch(graph, source, destination, heuristic,
+                                       scratch);
+}
+
+auto findShortestPath(const FrozenGraph& graph, NodeId source,
+                      NodeId destination, const Heuristic& heuristic,
+                      ShortestPathScratch* scratch) -> Opt<ShortestPath> {
+  return searchShortestPathWithScratch(graph, source, destination, heuristic,
+                                       scratch);
+}
+
+}  // namespace graph
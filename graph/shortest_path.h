@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "frozen_graph.h"
+#include "graph.h"
+
+namespace graph {
+
+struct ShortestPath {
+  Graph::Weight distance{};
+  Graph::NodeList path{};
+};
+
+// Must never overestimate the remaining distance and must be consistent.
+using Heuristic = std::function<Graph::Weight(Graph::NodeId)>;
+
+class ShortestPathScratch {
+ public:
+  using NodeId = Graph::NodeId;
+  using Weight = Graph::Weight;
+
+  struct QueueItem {
+    Weight priority{};
+    NodeId nodeId{};
+  };
+
+  void reset(std::size_t numNodes);
+
+  bool isReached(NodeId nodeId) const;
+  void reach(NodeId nodeId, Weight distance, NodeId parent);
+  bool settle(NodeId nodeId);
+  auto distanceOf(NodeId nodeId) const -> Weight { return distances_[nodeId]; }
+  auto parentOf(NodeId nodeId) const -> NodeId { return parents_[nodeId]; }
+
+  void push(Weight priority, NodeId nodeId);
+  auto pop() -> NodeId;
+  bool isQueueEmpty() const { return queue_.empty(); }
+
+ private:
+  using Epoch = std::uint32_t;
+
+  Epoch epoch_{};
+  std::vector<Epoch> reachEpochs_{};
+  std::vector<Epoch> settleEpochs_{};
+  std::vector<Weight> distances_{};
+  std::vector<NodeId> parents_{};
+  std::vector<QueueItem> queue_{};
+};
+
+auto findShortestPath(const Graph &graph, Graph::NodeId source,
+                      Graph::NodeId destination,
+                      const Heuristic &heuristic = {},
+                      ShortestPathScratch *scratch = nullptr)
+    -> Opt<ShortestPath>;
+auto findShortestPath(const FrozenGraph &graph, FrozenGraph::NodeId source,
+                      FrozenGraph::NodeId destination,
+                      const Heuristic &heuristic = {},
+                      ShortestPathScratch *scratch = nullptr)
+    -> Opt<ShortestPath>;
+
+}  // namespace graph
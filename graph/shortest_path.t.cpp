@@ -0,0 +1,196 @@
+#include <gtest/gtest.h>
+
+#include <limits>
+
+#include "graph_generators.h"
+#include "shortest_path.h"
+
+namespace graph {
+namespace {
+
+using NodeId = Graph::NodeId;
+using Weight = Graph::Weight;
+
+struct WeightedEdge {
+  NodeId source{};
+  NodeId destination{};
+  Weight weight{};
+};
+using WeightedEdges = std::vector<WeightedEdge>;
+
+struct TestCase_ShortestPath {
+  std::string name{};
+  std::size_t numNodes{};
+  WeightedEdges edges{};
+  NodeId source{};
+  NodeId destination{};
+  Opt<Weight> expectedDistance{};
+};
+
+constexpr auto INFINITE_WEIGHT = std::numeric_limits<Weight>::infinity();
+
+auto findDistancesTo(const Graph &graph, NodeId destination)
+    -> std::vector<Weight> {
+  auto distances = std::vector<Weight>(graph.numNodes(), INFINITE_WEIGHT);
+  distances[destination] = 0;
+  for (auto round = std::size_t(); round < graph.numNodes(); round++) {
+    for (auto nodeId = NodeId(); nodeId < graph.numNodes(); nodeId++) {
+      for (auto nextNodeId : graph.findNodesBySource(nodeId)) {
+        distances[nodeId] =
+            std::min(distances[nodeId], graph.weightOf(nodeId, nextNodeId) +
+                                            distances[nextNodeId]);
+      }
+    }
+  }
+  return distances;
+}
+
+auto findPathDistance(const Graph &graph, const Graph::NodeList &path)
+    -> Weight {
+  auto distance = Weight();
+  for (auto i = std::size_t(1); i < path.size(); i++) {
+    EXPECT_TRUE(graph.findNodesBySource(path[i - 1]).count(path[i]));
+    distance += graph.weightOf(path[i - 1], path[i]);
+  }
+  return distance;
+}
+
+}  // namespace
+
+class TestShortestPath
+    : public ::testing::TestWithParam<TestCase_ShortestPath> {
+ public:
+  using TestCase = TestCase_ShortestPath;
+
+  static auto getTestName(const ::testing::TestParamInfo<TestCase> &testInfo)
+      -> std::string {
+    return testInfo.param.name;
+  }
+
+ protected:
+  auto createGraph() const -> Graph;
+};
+
+INSTANTIATE_TEST_SUITE_P(
+    TestShortestPath, TestShortestPath,
+    testing::Values(
+
+        TestShortestPath::TestCase{"invalidNodes", 2, WeightedEdges{{0, 1, 1}},
+                                   0, 2, {}},
+        TestShortestPath::TestCase{"sameNode", 1, WeightedEdges{}, 0, 0, 0.0},
+        TestShortestPath::TestCase{"oneEdge", 2, WeightedEdges{{0, 1, 2.5}}, 0,
+                                   1, 2.5},
+        TestShortestPath::TestCase{"oneEdgeReversed", 2,
+                                   WeightedEdges{{0, 1, 2.5}}, 1, 0, {}},
+        TestShortestPath::TestCase{"zeroWeight", 3,
+                                   WeightedEdges{{0, 1, 0}, {1, 2, 0}}, 0, 2,
+                                   0.0},
+        TestShortestPath::TestCase{
+            "longerButLighter", 4,
+            WeightedEdges{{0, 3, 10}, {0, 1, 1}, {1, 2, 1}, {2, 3, 1}}, 0, 3,
+            3.0},
+        TestShortestPath::TestCase{
+            "shorterAndLighter", 4,
+            WeightedEdges{{0, 3, 2}, {0, 1, 1}, {1, 2, 1}, {2, 3, 1}}, 0, 3,
+            2.0},
+        TestShortestPath::TestCase{
+            "cycle", 3, WeightedEdges{{0, 1, 1}, {1, 2, 1}, {2, 0, 1}}, 1, 0,
+            2.0}
+
+        ),
+    &TestShortestPath::getTestName);
+
+TEST_P(TestShortestPath, testShortestPath) {
+  const auto &testCase = GetParam();
+
+  auto graph = createGraph();
+  auto frozenGraph = graph.freeze();
+  for (auto shortestPath :
+       {findShortestPath(graph, testCase.source, testCase.destination),
+        findShortestPath(frozenGraph, testCase.source, testCase.destination)}) {
+    ASSERT_EQ(testCase.expectedDistance.has_value(),
+              shortestPath.has_value());
+    if (!shortestPath) continue;
+
+    EXPECT_EQ(*testCase.expectedDistance, shortestPath->distance);
+    ASSERT_FALSE(shortestPath->path.empty());
+    EXPECT_EQ(testCase.source, shortestPath->path.front());
+    EXPECT_EQ(testCase.destination, shortestPath->path.back());
+    EXPECT_EQ(shortestPath->distance,
+              findPathDistance(graph, shortestPath->path));
+  }
+}
+
+auto TestShortestPath::createGraph() const -> Graph {
+  const auto &testCase = GetParam();
+
+  auto graph = Graph();
+  for (auto i = std::size_t(); i < testCase.numNodes; i++) {
+    graph.addNode(Color::Black);
+  }
+  for (auto [source, destination, weight] : testCase.edges) {
+    graph.addEdge(source, destination, weight);
+  }
+  return graph;
+}
+
+TEST(TestShortestPath_Invalid, testNegativeWeight) {
+  auto graph = Graph();
+  graph.addNode(Color::Black);
+  EXPECT_THROW(graph.addEdge(0, 0, -1), std::runtime_error);
+}
+
+// --- TestShortestPath_RandomGraph ---
+
+class TestShortestPath_RandomGraph
+    : public ::testing::TestWithParam<std::size_t> {};
+
+INSTANTIATE_TEST_SUITE_P(TestShortestPath_RandomGraph,
+                         TestShortestPath_RandomGraph,
+                         ::testing::Values(10, 50, 200));
+
+TEST_P(TestShortestPath_RandomGraph, testRandomGraph) {
+  constexpr auto NUM_DESTINATIONS = std::size_t(5);
+
+  auto numNodes = GetParam();
+  auto randomGenerator = RandomGenerator(4242);
+  auto graph = createRandomGraph(numNodes, 0, &randomGenerator);
+  for (auto i = std::size_t(); i < 3 * numNodes; i++) {
+    graph.addEdge(randomGenerator() % numNodes, randomGenerator() % numNodes,
+                  Weight(randomGenerator() % 10));
+  }
+  auto frozenGraph = graph.freeze();
+
+  auto scratch = ShortestPathScratch();
+  for (auto i = std::size_t(); i < NUM_DESTINATIONS; i++) {
+    auto destination = NodeId(randomGenerator() % numNodes);
+    auto distances = findDistancesTo(graph, destination);
+    auto heuristic = [&distances](NodeId nodeId) {
+      return distances[nodeId] / 2;
+    };
+
+    for (auto source = NodeId(); source < numNodes; source++) {
+      auto expectedDistance = distances[source];
+      for (auto shortestPath :
+           {findShortestPath(graph, source, destination, {}, &scratch),
+            findShortestPath(frozenGraph, source, destination, {}, &scratch),
+            findShortestPath(graph, source, destination, heuristic,
+                             &scratch),
+            findShortestPath(frozenGraph, source, destination, heuristic,
+                             &scratch)}) {
+        ASSERT_EQ(expectedDistance != INFINITE_WEIGHT,
+                  shortestPath.has_value())
+            << source << " -> " << destination;
+        if (!shortestPath) continue;
+
+        EXPECT_EQ(expectedDistance, shortestPath->distance)
+            << source << " -> " << destination;
+        EXPECT_EQ(expectedDistance,
+                  findPathDistance(graph, shortestPath->path))
+            << source << " -> " << destination;
+      }
+    }
+  }
+}
+
+}  // namespace graph
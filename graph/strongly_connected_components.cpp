@@ -0,0 +1,145 @@
+#include "strongly_connected_components.h"
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+namespace graph {
+namespace {
+
+using ComponentId = StronglyConnectedComponents::ComponentId;
+using NodeId = Graph::NodeId;
+
+constexpr auto UNVISITED = std::numeric_limits<std::size_t>::max();
+
+class Tarjan {
+ public:
+  explicit Tarjan(const Graph& graph);
+
+  auto run() -> std::vector<ComponentId>;
+  auto numComponents() const -> std::size_t { return numComponents_; }
+
+ private:
+  struct Frame {
+    NodeId nodeId{};
+    Graph::NodeIds::const_iterator nextIt{};
+    Graph::NodeIds::const_iterator endIt{};
+  };
+
+  const Graph* graph_{};
+  std::vector<std::size_t> visitIndexes_{};
+  std::vector<std::size_t> lowLinks_{};
+  std::vector<bool> isOnStack_{};
+  std::vector<NodeId> stack_{};
+  std::vector<Frame> frames_{};
+  std::vector<ComponentId> componentIds_{};
+  std::size_t nextVisitIndex_{};
+  std::size_t numComponents_{};
+
+  void enter(NodeId nodeId);
+  void leave(NodeId nodeId);
+};
+
+Tarjan::Tarjan(const Graph& graph)
+    : graph_(&graph),
+      visitIndexes_(graph.numNodes(), UNVISITED),
+      lowLinks_(graph.numNodes()),
+      isOnStack_(graph.numNodes()),
+      componentIds_(graph.numNodes(), UNVISITED) {}
+
+auto Tarjan::run() -> std::vector<ComponentId> {
+  for (auto rootId = NodeId(); rootId < graph_->numNodes(); rootId++) {
+    if (visitIndexes_[rootId] != UNVISITED) continue;
+
+    enter(rootId);
+    while (!frames_.empty()) {
+      auto& frame = frames_.back();
+      auto nodeId = frame.nodeId;
+      if (frame.nextIt == frame.endIt) {
+        frames_.pop_back();
+        leave(nodeId);
+        continue;
+      }
+
+      auto nextNodeId = *frame.nextIt;
+      ++frame.nextIt;
+      if (visitIndexes_[nextNodeId] == UNVISITED) {
+        enter(nextNodeId);
+      } else if (isOnStack_[nextNodeId]) {
+        lowLinks_[nodeId] =
+            std::min(lowLinks_[nodeId], visitIndexes_[nextNodeId]);
+      }
+    }
+  }
+
+  return std::move(componentIds_);
+}
+
+void Tarjan::enter(NodeId nodeId) {
+  visitIndexes_[nodeId] = lowLinks_[nodeId] = nextVisitIndex_++;
+  stack_.push_back(nodeId);
+  isOnStack_[nodeId] = true;
+
+  const auto& nextNodes = graph_->findNodesBySource(nodeId);
+  frames_.push_back({nodeId, nextNodes.begin(), nextNodes.end()});
+}
+
+void Tarjan::leave(NodeId nodeId) {
+  if (!frames_.empty()) {
+    auto parentId = frames_.back().nodeId;
+    lowLinks_[parentId] = std::min(lowLinks_[parentId], lowLinks_[nodeId]);
+  }
+  if (lowLinks_[nodeId] != visitIndexes_[nodeId]) {
+    return;
+  }
+
+  auto componentId = numComponents_++;
+  auto memberId = NodeId();
+  do {
+    memberId = stack_.back();
+    stack_.pop_back();
+    isOnStack_[memberId] = false;
+    componentIds_[memberId] = componentId;
+  } while (memberId != nodeId);
+}
+
+auto condense(const Graph& graph, const std::vector<ComponentId>& componentIds,
+              std::size_t numComponents) -> Graph {
+  auto colors = std::vector<Color>(numComponents);
+  auto hasColor = std::vector<bool>(numComponents);
+  auto componentSizes = std::vector<std::size_t>(numComponents);
+  for (auto nodeId = NodeId(); nodeId < componentIds.size(); nodeId++) {
+    auto componentId = componentIds[nodeId];
+    if (!hasColor[componentId]) {
+      colors[componentId] = graph.colorOf(nodeId);
+      hasColor[componentId] = true;
+    }
+    componentSizes[componentId]++;
+  }
+
+  auto edges = Graph::EdgeList();
+  for (auto nodeId = NodeId(); nodeId < componentIds.size(); nodeId++) {
+    auto componentId = componentIds[nodeId];
+    for (auto nextNodeId : graph.findNodesBySource(nodeId)) {
+      auto nextComponentId = componentIds[nextNodeId];
+      if (nextComponentId != componentId || componentSizes[componentId] > 1 ||
+          nextNodeId == nodeId) {
+        edges.emplace_back(componentId, nextComponentId);
+      }
+    }
+  }
+
+  return Graph::fromEdgeList(std::move(colors), std::move(edges));
+}
+
+}  // namespace
+
+auto findStronglyConnectedComponents(const Graph& graph)
+    -> StronglyConnectedComponents {
+  auto tarjan = Tarjan(graph);
+  auto componentIds = tarjan.run();
+  auto condensation = condense(graph, componentIds, tarjan.numComponents());
+  return {std::move(componentIds), std::move(condensation)};
+}
+
+}  // namespace graph
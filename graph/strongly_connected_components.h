@@ -0,0 +1,24 @@
+#pragma once
+
+#include <vector>
+
+#include "graph.h"
+
+namespace graph {
+
+struct StronglyConnectedComponents {
+  using ComponentId = std::size_t;
+
+  // Component ids are assigned in reverse topological order: every edge of
+  // the condensation goes from a higher to a lower component id. Each
+  // component node takes the colour of its lowest NodeId, and components
+  // containing a cycle keep a self-loop so that reachability through at
+  // least one edge is preserved.
+  std::vector<ComponentId> componentIds{};
+  Graph condensation{};
+};
+
+auto findStronglyConnectedComponents(const Graph &graph)
+    -> StronglyConnectedComponents;
+
+}  // namespace graph
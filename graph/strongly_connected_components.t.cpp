@@ -0,0 +1,107 @@
+
+#include <gtest/gtest.h>
+
+#include "are_connected.h"
+#include "graph_generators.h"
+#include "strongly_connected_components.h"
+
+namespace graph {
+
+using NodeId = Graph::NodeId;
+using ComponentId = StronglyConnectedComponents::ComponentId;
+
+// --- TestStronglyConnectedComponents ---
+
+class TestStronglyConnectedComponents
+    : public ::testing::TestWithParam<std::size_t> {};
+
+INSTANTIATE_TEST_SUITE_P(TestStronglyConnectedComponents,
+                         TestStronglyConnectedComponents,
+                         ::testing::Values(1, 10, 100, 500));
+
+TEST_P(TestStronglyConnectedComponents, testRandomGraph) {
+  auto numNodes = GetParam();
+  auto randomGenerator = RandomGenerator(4242);
+  auto graph = createRandomGraph(numNodes, numNodes * 3 / 2, &randomGenerator);
+
+  auto components = findStronglyConnectedComponents(graph);
+  const auto &componentIds = components.componentIds;
+  const auto &condensation = components.condensation;
+  ASSERT_EQ(numNodes, componentIds.size());
+
+  for (auto source = NodeId(); source < numNodes; source++) {
+    for (auto destination = NodeId(); destination < numNodes; destination++) {
+      auto sourceComponent = componentIds[source];
+      auto destinationComponent = componentIds[destination];
+
+      auto isSameComponent =
+          source == destination || (areConnected(graph, source, destination) &&
+                                    areConnected(graph, destination, source));
+      EXPECT_EQ(isSameComponent, sourceComponent == destinationComponent)
+          << source << " <-> " << destination;
+
+      EXPECT_EQ(areConnected(graph, source, destination),
+                areConnected(condensation, sourceComponent,
+                             destinationComponent))
+          << source << " -> " << destination;
+    }
+
+    for (auto nextNodeId : graph.findNodesBySource(source)) {
+      EXPECT_GE(componentIds[source], componentIds[nextNodeId]);
+    }
+  }
+}
+
+// --- TestStronglyConnectedComponents_Shapes ---
+
+TEST(TestStronglyConnectedComponents_Shapes, testEmptyGraph) {
+  auto components = findStronglyConnectedComponents(Graph());
+  EXPECT_TRUE(components.componentIds.empty());
+  EXPECT_EQ(0, components.condensation.numNodes());
+}
+
+TEST(TestStronglyConnectedComponents_Shapes, testCycles) {
+  auto graph = Graph();
+  for (auto color : {Color::Red, Color::Green, Color::Blue, Color::White}) {
+    graph.addNode(color);
+  }
+  graph.addEdge(0, 1);
+  graph.addEdge(1, 0);
+  graph.addEdge(1, 2);
+  graph.addEdge(3, 3);
+
+  auto components = findStronglyConnectedComponents(graph);
+  const auto &componentIds = components.componentIds;
+  const auto &condensation = components.condensation;
+  EXPECT_EQ(componentIds[0], componentIds[1]);
+  EXPECT_NE(componentIds[0], componentIds[2]);
+  EXPECT_NE(componentIds[0], componentIds[3]);
+  EXPECT_EQ(3, condensation.numNodes());
+
+  EXPECT_EQ(Color::Red, condensation.colorOf(componentIds[0]));
+  EXPECT_EQ(Color::Blue, condensation.colorOf(componentIds[2]));
+  EXPECT_TRUE(areConnected(condensation, componentIds[0], componentIds[0]));
+  EXPECT_FALSE(areConnected(condensation, componentIds[2], componentIds[2]));
+  EXPECT_TRUE(areConnected(condensation, componentIds[3], componentIds[3]));
+}
+
+TEST(TestStronglyConnectedComponents_Shapes, testDeepChain) {
+  constexpr auto NUM_NODES = NodeId(1'000'000);
+
+  auto graph = Graph();
+  for (auto nodeId = NodeId(); nodeId < NUM_NODES; nodeId++) {
+    graph.addNode(Color::Black);
+    if (nodeId > 0) {
+      graph.addEdge(nodeId - 1, nodeId);
+    }
+  }
+  graph.addEdge(NUM_NODES - 1, NUM_NODES / 2);
+
+  auto components = findStronglyConnectedComponents(graph);
+  const auto &componentIds = components.componentIds;
+  EXPECT_EQ(NUM_NODES / 2 + 1, components.condensation.numNodes());
+  EXPECT_EQ(componentIds[NUM_NODES / 2], componentIds[NUM_NODES - 1]);
+  EXPECT_GT(componentIds[0], componentIds[1]);
+}
+
+}  // namespace graph
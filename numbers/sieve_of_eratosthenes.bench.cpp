@@ -14,27 +14,68 @@ void BM_FindPrimeNumbers(benchmark::State &state) {
   state.SetComplexityN(state.range(0));
 }
 
+void BM_ForEachPrime(benchmark::State &state) {
+  auto maxNumber = numbers::Number(state.range(0));
+  for (auto _ : state) {
+    auto numPrimes = std::size_t();
+    numbers::forEachPrime(0, maxNumber,
+                          [&numPrimes](numbers::Number) { numPrimes++; });
+    benchmark::DoNotOptimize(numPrimes);
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+template <unsigned maxThreads>
+void BM_CountPrimes(benchmark::State &state) {
+  auto maxNumber = numbers::Number(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(numbers::countPrimes(0, maxNumber, maxThreads));
+  }
+  state.SetComplexityN(state.range(0));
+}
+
 }  // namespace
 
 BENCHMARK_TEMPLATE(BM_FindPrimeNumbers, 1)
     ->RangeMultiplier(10)
-    ->Range(1'000, 10'000'000)
+    ->Range(1'000, 1'000'000'000)
+    ->UseRealTime()
     ->Complexity();
 BENCHMARK_TEMPLATE(BM_FindPrimeNumbers, 2)
     ->RangeMultiplier(10)
-    ->Range(1'000, 10'000'000)
+    ->Range(1'000, 1'000'000'000)
+    ->UseRealTime()
     ->Complexity();
 BENCHMARK_TEMPLATE(BM_FindPrimeNumbers, 4)
     ->RangeMultiplier(10)
-    ->Range(1'000, 10'000'000)
+    ->Range(1'000, 1'000'000'000)
+    ->UseRealTime()
     ->Complexity();
 BENCHMARK_TEMPLATE(BM_FindPrimeNumbers, 8)
     ->RangeMultiplier(10)
-    ->Range(1'000, 10'000'000)
+    ->Range(1'000, 1'000'000'000)
+    ->UseRealTime()
     ->Complexity();
 BENCHMARK_TEMPLATE(BM_FindPrimeNumbers, 16)
     ->RangeMultiplier(10)
-    ->Range(1'000, 10'000'000)
+    ->Range(1'000, 1'000'000'000)
+    ->UseRealTime()
+    ->Complexity();
+
+BENCHMARK(BM_ForEachPrime)
+    ->RangeMultiplier(10)
+    ->Range(1'000, 1'000'000'000)
+    ->Complexity();
+
+BENCHMARK_TEMPLATE(BM_CountPrimes, 1)
+    ->RangeMultiplier(10)
+    ->Range(1'000, 10'000'000'000)
+    ->UseRealTime()
+    ->Complexity();
+BENCHMARK_TEMPLATE(BM_CountPrimes, 4)
+    ->RangeMultiplier(10)
+    ->Range(1'000, 10'000'000'000)
+    ->UseRealTime()
     ->Complexity();
 
 BENCHMARK_MAIN();
@@ -1,15 +1,35 @@
 
 #include "sieve_of_eratosthenes.h"
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <cassert>
 #include <cmath>
-#include <future>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <numeric>
 #include <thread>
-#include <valarray>
 
 namespace numbers {
 namespace {
 
+constexpr auto MAX_SEQUENTIAL_NUMBER = Number(10'000);
+constexpr auto SEGMENT_BYTES = std::size_t(32 * 1024);
+constexpr auto BITS_PER_WORD = std::size_t(64);
+constexpr auto SEGMENT_WORDS = SEGMENT_BYTES / sizeof(std::uint64_t);
+constexpr auto BITS_PER_SEGMENT = SEGMENT_WORDS * BITS_PER_WORD;
+constexpr auto NUMBERS_PER_SEGMENT = Number(2 * BITS_PER_SEGMENT);
+constexpr auto CLAIMS_PER_THREAD = std::size_t(8);
+constexpr auto WHEEL_PRIMES = std::array<Number, 5>{3, 5, 7, 11, 13};
+constexpr auto WHEEL_BITS = std::size_t(3 * 5 * 7 * 11 * 13);
+constexpr auto WHEEL_WORDS = WHEEL_BITS / BITS_PER_WORD + SEGMENT_WORDS + 2;
+
 auto getNumberOfCpus() -> unsigned {
   return std::thread::hardware_concurrency();
 }
@@ -20,7 +40,7 @@ auto findPrimeNumbersSequentially(Number maxNumber) -> std::vector<Number> {
   std::vector<bool> sieve;
   sieve.resize(maxNumber);
 
-  for (auto x = 2; x < maxNumber; x++) {
+  for (auto x = Number(2); x < maxNumber; x++) {
     if (!sieve[x]) {
       foundPrimeNumbers.emplace_back(x);
       for (auto multiplierOfX = 2 * x; multiplierOfX < maxNumber;
@@ -33,82 +53,533 @@ auto findPrimeNumbersSequentially(Number maxNumber) -> std::vector<Number> {
   return foundPrimeNumbers;
 }
 
-auto findFirstDividend(Number primeNumber, Number minNumber) {
-  auto firstDividend = minNumber - (minNumber % primeNumber);
-  if (firstDividend < minNumber) {
-    firstDividend += primeNumber;
+auto findLowestBit(std::uint64_t value) -> std::size_t {
+#ifdef _MSC_VER
+  auto bit = 0UL;
+  _BitScanForward64(&bit, value);
+  return std::size_t(bit);
+#else
+  return std::size_t(__builtin_ctzll(value));
+#endif
+}
+
+auto countBits(std::uint64_t value) -> std::size_t {
+#ifdef _MSC_VER
+  return std::size_t(__popcnt64(value));
+#else
+  return std::size_t(__builtin_popcountll(value));
+#endif
+}
+
+auto makeWheelPattern() -> std::vector<std::uint64_t> {
+  auto wheelPattern = std::vector<std::uint64_t>(WHEEL_WORDS);
+  for (auto bit = std::size_t(); bit < WHEEL_WORDS * BITS_PER_WORD; bit++) {
+    auto number = 2 * Number(bit) + 1;
+    for (auto prime : WHEEL_PRIMES) {
+      if (number % prime == 0) {
+        wheelPattern[bit / BITS_PER_WORD] |= std::uint64_t(1)
+                                             << (bit % BITS_PER_WORD);
+        break;
+      }
+    }
   }
+  return wheelPattern;
+}
+
+auto getWheelPattern() -> const std::vector<std::uint64_t> & {
+  static const auto wheelPattern = makeWheelPattern();
+  return wheelPattern;
+}
 
-  firstDividend = std::max(firstDividend, primeNumber * primeNumber);
-  assert(firstDividend >= minNumber);
-  return firstDividend;
+auto findSquareRoot(Number number) -> Number {
+  auto root = Number(std::sqrt(double(number)));
+  while (root > 0 && root > number / root) {
+    root--;
+  }
+  while (root + 1 <= number / (root + 1)) {
+    root++;
+  }
+  return root;
 }
 
-auto findPrimeNumbersInRange(const std::vector<Number> &basePrimes,
-                             Number minNumber, Number maxNumber)
+auto findBasePrimes(Number maxNumber, unsigned numThreads)
     -> std::vector<Number> {
-  assert(!basePrimes.empty());
-  assert(minNumber < maxNumber);
+  auto basePrimesMax = maxNumber > 1 ? findSquareRoot(maxNumber - 1) + 1 : 0;
+  return findPrimeNumbers(basePrimesMax, numThreads);
+}
 
-  auto foundPrimeNumbers = std::vector<Number>();
+// Runs each job on the calling thread and on up to numWorkers - 1 pooled
+// helpers. Jobs from concurrent callers queue up and share the helpers, so a
+// job must split its work dynamically: once the caller's own call returns,
+// helpers that have not started yet are withdrawn.
+class WorkerPool {
+ public:
+  using Job = std::function<void()>;
 
-  std::vector<bool> sieve;
-  sieve.resize(maxNumber - minNumber);
+  WorkerPool() = default;
+  WorkerPool(const WorkerPool &) = delete;
+  auto operator=(const WorkerPool &) -> WorkerPool & = delete;
+  ~WorkerPool();
+
+  static auto instance() -> WorkerPool &;
 
-  for (auto basePrime : basePrimes) {
-    for (auto x = findFirstDividend(basePrime, minNumber); x < maxNumber;
-         x += basePrime) {
-      sieve[x - minNumber] = true;
+  void run(unsigned numWorkers, const Job &job);
+
+ private:
+  struct Task {
+    const Job *job{};
+    std::exception_ptr error{};
+    unsigned numUnclaimed{};
+    unsigned numRunning{};
+  };
+
+  std::mutex mutex_{};
+  std::condition_variable taskPosted_{};
+  std::condition_variable taskDone_{};
+  std::vector<std::thread> threads_{};
+  std::deque<Task *> tasks_{};
+  bool isStopping_{};
+
+  void runWorker();
+};
+
+WorkerPool::~WorkerPool() {
+  {
+    auto lock = std::lock_guard(mutex_);
+    isStopping_ = true;
+  }
+  taskPosted_.notify_all();
+  for (auto &thread : threads_) {
+    thread.join();
+  }
+}
+
+auto WorkerPool::instance() -> WorkerPool & {
+  static auto workerPool = WorkerPool();
+  return workerPool;
+}
+
+void WorkerPool::run(unsigned numWorkers, const Job &job) {
+  if (numWorkers <= 1) {
+    job();
+    return;
+  }
+
+  auto numHelpers = numWorkers - 1;
+  auto task = Task{&job, nullptr, numHelpers, 0};
+  {
+    auto lock = std::lock_guard(mutex_);
+    while (threads_.size() < numHelpers) {
+      threads_.emplace_back(&WorkerPool::runWorker, this);
     }
+    tasks_.push_back(&task);
   }
+  taskPosted_.notify_all();
 
-  for (auto x = 0; x < sieve.size(); x++) {
-    if (!sieve[x]) {
-      foundPrimeNumbers.emplace_back(x + minNumber);
+  auto error = std::exception_ptr();
+  try {
+    job();
+  } catch (...) {
+    error = std::current_exception();
+  }
+
+  auto lock = std::unique_lock(mutex_);
+  if (task.numUnclaimed > 0) {
+    tasks_.erase(std::find(tasks_.begin(), tasks_.end(), &task));
+    task.numUnclaimed = 0;
+  }
+  taskDone_.wait(lock, [&task]() { return task.numRunning == 0; });
+  if (!error) {
+    error = task.error;
+  }
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
+
+void WorkerPool::runWorker() {
+  auto lock = std::unique_lock(mutex_);
+  while (true) {
+    taskPosted_.wait(lock,
+                     [this]() { return isStopping_ || !tasks_.empty(); });
+    if (isStopping_) {
+      return;
+    }
+    auto &task = *tasks_.front();
+    if (--task.numUnclaimed == 0) {
+      tasks_.pop_front();
+    }
+    task.numRunning++;
+    lock.unlock();
+    auto error = std::exception_ptr();
+    try {
+      (*task.job)();
+    } catch (...) {
+      error = std::current_exception();
+    }
+    lock.lock();
+    if (error && !task.error) {
+      task.error = error;
+    }
+    if (--task.numRunning == 0) {
+      taskDone_.notify_all();
     }
   }
+}
 
-  return foundPrimeNumbers;
+class SegmentedSieve {
+ public:
+  explicit SegmentedSieve(const std::vector<Number> &basePrimes);
+
+  auto segmentEnd() const -> Number { return segmentEnd_; }
+  void seek(Number minNumber);
+  void sieveSegment(Number maxNumber);
+  void collectPrimes(std::vector<Number> *primeNumbers) const;
+  auto countPrimes() const -> Number;
+
+ private:
+  struct BucketedPrime {
+    std::uint32_t primeIndex{};
+    std::uint32_t nextIndex{};
+  };
+
+  const std::vector<Number> *basePrimes_{};
+  std::size_t firstSievingPrime_{};
+  std::size_t firstBucketedPrime_{};
+  std::size_t numActivePrimes_{};
+  std::vector<Number> nextIndices_{};
+  std::vector<std::vector<BucketedPrime>> buckets_{};
+  std::size_t currentBucket_{};
+  std::vector<std::uint64_t> composites_{};
+  Number segmentBegin_{};
+  Number segmentEnd_{};
+
+  void schedulePrime(std::size_t primeIndex, Number nextIndex);
+  void fillWheelPattern();
+  void setComposite(Number index) {
+    composites_[index / BITS_PER_WORD] |= std::uint64_t(1)
+                                          << (index % BITS_PER_WORD);
+  }
+};
+
+SegmentedSieve::SegmentedSieve(const std::vector<Number> &basePrimes)
+    : basePrimes_(&basePrimes), composites_(SEGMENT_WORDS) {
+  firstSievingPrime_ = std::size_t(
+      std::upper_bound(basePrimes.begin(), basePrimes.end(),
+                       WHEEL_PRIMES.back()) -
+      basePrimes.begin());
+  firstBucketedPrime_ = std::size_t(
+      std::lower_bound(basePrimes.begin(), basePrimes.end(),
+                       Number(BITS_PER_SEGMENT)) -
+      basePrimes.begin());
+  firstBucketedPrime_ = std::max(firstBucketedPrime_, firstSievingPrime_);
+  nextIndices_.resize(firstBucketedPrime_ - firstSievingPrime_);
+  if (firstBucketedPrime_ < basePrimes.size()) {
+    buckets_.resize(std::size_t(basePrimes.back() / BITS_PER_SEGMENT) + 3);
+  }
 }
 
-}  // namespace
+void SegmentedSieve::seek(Number minNumber) {
+  segmentBegin_ = minNumber - minNumber % 2;
+  segmentEnd_ = segmentBegin_;
+  for (auto &bucket : buckets_) {
+    bucket.clear();
+  }
+  currentBucket_ = 0;
 
-auto findPrimeNumbers(Number maxNumber, Opt<unsigned> maxThreads)
-    -> std::vector<Number> {
-  auto numThreads = maxThreads ? maxThreads.value() : getNumberOfCpus();
+  numActivePrimes_ = firstSievingPrime_;
+  for (; numActivePrimes_ < basePrimes_->size(); numActivePrimes_++) {
+    auto prime = (*basePrimes_)[numActivePrimes_];
+    if (prime * prime > segmentBegin_) {
+      break;
+    }
+    auto offset = 1 + (prime - (segmentBegin_ + 1) % prime) % prime;
+    if (offset % 2 == 0) {
+      offset += prime;
+    }
+    schedulePrime(numActivePrimes_, offset / 2);
+  }
+}
+
+void SegmentedSieve::sieveSegment(Number maxNumber) {
+  assert(segmentEnd_ < maxNumber);
+  segmentBegin_ = segmentEnd_;
+  segmentEnd_ = segmentBegin_ + std::min(maxNumber - segmentBegin_,
+                                         NUMBERS_PER_SEGMENT);
+  auto numBits = (segmentEnd_ - segmentBegin_) / 2;
 
-  auto sequentialMaxNumbers =
-      numThreads == 1 ? maxNumber : std::min(maxNumber, Number(10'000));
-  if (sequentialMaxNumbers == maxNumber) {
-    return findPrimeNumbersSequentially(sequentialMaxNumbers);
+  for (; numActivePrimes_ < basePrimes_->size(); numActivePrimes_++) {
+    auto prime = (*basePrimes_)[numActivePrimes_];
+    if (prime * prime >= segmentEnd_) {
+      break;
+    }
+    schedulePrime(numActivePrimes_, (prime * prime - segmentBegin_) / 2);
   }
 
-  auto firstPrimeNumbersMax = Number(std::lround(std::sqrt(maxNumber)));
-  auto firstPrimeNumbers = findPrimeNumbersSequentially(firstPrimeNumbersMax);
+  fillWheelPattern();
+  auto numActiveSmallPrimes = std::min(numActivePrimes_, firstBucketedPrime_);
+  for (auto primeIndex = firstSievingPrime_;
+       primeIndex < numActiveSmallPrimes; primeIndex++) {
+    auto prime = (*basePrimes_)[primeIndex];
+    auto &nextIndex = nextIndices_[primeIndex - firstSievingPrime_];
+    auto index = nextIndex;
+    for (; index < numBits; index += prime) {
+      setComposite(index);
+    }
+    nextIndex = index - numBits;
+  }
 
-  auto tasks = std::vector<std::future<std::vector<Number>>>();
-  tasks.resize(numThreads);
+  if (!buckets_.empty()) {
+    auto &bucket = buckets_[currentBucket_];
+    currentBucket_ = (currentBucket_ + 1) % buckets_.size();
+    for (auto bucketedPrime : bucket) {
+      auto index = Number(bucketedPrime.nextIndex);
+      setComposite(index);
+      schedulePrime(bucketedPrime.primeIndex,
+                    index + (*basePrimes_)[bucketedPrime.primeIndex] -
+                        numBits);
+    }
+    bucket.clear();
+  }
 
-  auto partStart = firstPrimeNumbersMax;
-  auto partSize = (maxNumber - partStart) / numThreads;
-  for (auto &task : tasks) {
-    bool isLastPart = (&task == &tasks.back());
-    auto partEnd = isLastPart ? maxNumber : partStart + partSize;
+  if (numBits % BITS_PER_WORD) {
+    composites_[numBits / BITS_PER_WORD] |= ~std::uint64_t(0)
+                                            << (numBits % BITS_PER_WORD);
+  }
+  for (auto word = (numBits + BITS_PER_WORD - 1) / BITS_PER_WORD;
+       word < SEGMENT_WORDS; word++) {
+    composites_[word] = ~std::uint64_t(0);
+  }
+}
 
-    task = std::async(std::launch::async, findPrimeNumbersInRange,
-                      firstPrimeNumbers, partStart, partEnd);
+void SegmentedSieve::schedulePrime(std::size_t primeIndex, Number nextIndex) {
+  if (primeIndex < firstBucketedPrime_) {
+    nextIndices_[primeIndex - firstSievingPrime_] = nextIndex;
+    return;
+  }
+  auto bucket = (currentBucket_ + std::size_t(nextIndex / BITS_PER_SEGMENT)) %
+                buckets_.size();
+  buckets_[bucket].push_back({std::uint32_t(primeIndex),
+                              std::uint32_t(nextIndex % BITS_PER_SEGMENT)});
+}
 
-    partStart += partSize;
+void SegmentedSieve::fillWheelPattern() {
+  auto firstBit = std::size_t(segmentBegin_ / 2 % WHEEL_BITS);
+  auto wheelWords = getWheelPattern().data() + firstBit / BITS_PER_WORD;
+  auto shift = firstBit % BITS_PER_WORD;
+  if (shift == 0) {
+    std::memcpy(composites_.data(), wheelWords, SEGMENT_BYTES);
+  } else {
+    for (auto word = std::size_t(); word < SEGMENT_WORDS; word++) {
+      composites_[word] = (wheelWords[word] >> shift) |
+                          (wheelWords[word + 1] << (BITS_PER_WORD - shift));
+    }
   }
 
-  auto primeNumbers = firstPrimeNumbers;
-  for (auto &task : tasks) {
-    auto partResult = task.get();
-    primeNumbers.insert(primeNumbers.end(), partResult.begin(),
-                        partResult.end());
+  for (auto prime : WHEEL_PRIMES) {
+    if (segmentBegin_ < prime && prime < segmentEnd_) {
+      auto index = (prime - segmentBegin_) / 2;
+      composites_[index / BITS_PER_WORD] &=
+          ~(std::uint64_t(1) << (index % BITS_PER_WORD));
+    }
+  }
+}
+
+void SegmentedSieve::collectPrimes(std::vector<Number> *primeNumbers) const {
+  for (auto word = std::size_t(); word < SEGMENT_WORDS; word++) {
+    auto primeBits = ~composites_[word];
+    while (primeBits) {
+      auto index = word * BITS_PER_WORD + findLowestBit(primeBits);
+      primeNumbers->emplace_back(segmentBegin_ + 2 * Number(index) + 1);
+      primeBits &= primeBits - 1;
+    }
+  }
+}
+
+auto SegmentedSieve::countPrimes() const -> Number {
+  auto numPrimes = Number();
+  for (auto word : composites_) {
+    numPrimes += countBits(~word);
+  }
+  return numPrimes;
+}
+
+auto countSegments(Number minNumber, Number maxNumber) -> std::size_t {
+  auto firstSegmentBegin = minNumber - minNumber % 2;
+  return std::size_t((maxNumber - firstSegmentBegin - 1) /
+                         NUMBERS_PER_SEGMENT +
+                     1);
+}
+
+template <class SegmentFunction>
+void sieveSegmentsInParallel(const std::vector<Number> &basePrimes,
+                             Number minNumber, Number maxNumber,
+                             unsigned numThreads,
+                             const SegmentFunction &segmentFunction) {
+  auto firstSegmentBegin = minNumber - minNumber % 2;
+  auto numSegments = countSegments(minNumber, maxNumber);
+  auto segmentsPerClaim =
+      std::max(numSegments / (numThreads * CLAIMS_PER_THREAD), std::size_t(1));
+  auto nextSegment = std::atomic<std::size_t>();
+  WorkerPool::instance().run(numThreads, [&]() {
+    auto sieve = SegmentedSieve(basePrimes);
+    for (auto firstSegment = nextSegment.fetch_add(segmentsPerClaim);
+         firstSegment < numSegments;
+         firstSegment = nextSegment.fetch_add(segmentsPerClaim)) {
+      sieve.seek(firstSegmentBegin +
+                 Number(firstSegment) * NUMBERS_PER_SEGMENT);
+      auto lastSegment = std::min(firstSegment + segmentsPerClaim, numSegments);
+      for (auto segment = firstSegment; segment < lastSegment; segment++) {
+        sieve.sieveSegment(maxNumber);
+        segmentFunction(segment, sieve);
+      }
+    }
+  });
+}
+
+auto findPrimeNumbersInSegments(std::vector<Number> basePrimes,
+                                Number minNumber, Number maxNumber,
+                                unsigned numThreads) -> std::vector<Number> {
+  assert(!basePrimes.empty());
+  assert(minNumber < maxNumber);
+
+  auto numSegments = countSegments(minNumber, maxNumber);
+  auto segmentPrimes = std::vector<std::vector<Number>>(numSegments);
+  sieveSegmentsInParallel(
+      basePrimes, minNumber, maxNumber, numThreads,
+      [&](std::size_t segment, const SegmentedSieve &sieve) {
+        sieve.collectPrimes(&segmentPrimes[segment]);
+      });
+
+  auto primeOffsets = std::vector<std::size_t>(numSegments + 1);
+  primeOffsets[0] = basePrimes.size();
+  for (auto segment = std::size_t(); segment < numSegments; segment++) {
+    primeOffsets[segment + 1] =
+        primeOffsets[segment] + segmentPrimes[segment].size();
   }
 
+  auto primeNumbers = std::move(basePrimes);
+  primeNumbers.resize(primeOffsets.back());
+  auto nextSegment = std::atomic<std::size_t>();
+  WorkerPool::instance().run(numThreads, [&]() {
+    for (auto segment = nextSegment++; segment < numSegments;
+         segment = nextSegment++) {
+      std::copy(segmentPrimes[segment].begin(), segmentPrimes[segment].end(),
+                primeNumbers.begin() + primeOffsets[segment]);
+      std::vector<Number>().swap(segmentPrimes[segment]);
+    }
+  });
   return primeNumbers;
 }
 
-}  // namespace numbers
\ No newline at end of file
+}  // namespace
+
+struct PrimeRange::Generator {
+  Generator(Number minNumber, Number maxNumber);
+
+  bool sieveNextSegment(std::vector<Number> *primeNumbers);
+
+  std::vector<Number> basePrimes;
+  SegmentedSieve sieve;
+  Number maxNumber{};
+  bool isTwoPending{};
+};
+
+PrimeRange::Generator::Generator(Number minNumber, Number maxNumber)
+    : basePrimes(findBasePrimes(maxNumber, 1)),
+      sieve(basePrimes),
+      maxNumber(maxNumber),
+      isTwoPending(minNumber <= 2 && 2 < maxNumber) {
+  sieve.seek(std::max(minNumber, Number(3)));
+}
+
+bool PrimeRange::Generator::sieveNextSegment(
+    std::vector<Number> *primeNumbers) {
+  primeNumbers->clear();
+  if (isTwoPending) {
+    primeNumbers->push_back(2);
+    isTwoPending = false;
+  }
+  while (primeNumbers->empty() && sieve.segmentEnd() < maxNumber) {
+    sieve.sieveSegment(maxNumber);
+    sieve.collectPrimes(primeNumbers);
+  }
+  return !primeNumbers->empty();
+}
+
+PrimeRange::Iterator::Iterator(PrimeRange *range) : range_(range) {
+  if (range_->primes_.empty() && !range_->fetchPrimes()) {
+    range_ = nullptr;
+  }
+}
+
+auto PrimeRange::Iterator::operator++() -> Iterator & {
+  if (++index_ == range_->primes_.size()) {
+    index_ = 0;
+    if (!range_->fetchPrimes()) {
+      range_ = nullptr;
+    }
+  }
+  return *this;
+}
+
+PrimeRange::PrimeRange(Number minNumber, Number maxNumber) {
+  if (minNumber < maxNumber) {
+    generator_ = std::make_unique<Generator>(minNumber, maxNumber);
+  }
+}
+
+PrimeRange::PrimeRange(PrimeRange &&) noexcept = default;
+
+auto PrimeRange::operator=(PrimeRange &&) noexcept -> PrimeRange & = default;
+
+PrimeRange::~PrimeRange() = default;
+
+bool PrimeRange::fetchPrimes() {
+  return generator_ && generator_->sieveNextSegment(&primes_);
+}
+
+void forEachPrime(Number minNumber, Number maxNumber,
+                  const std::function<void(Number)> &callback) {
+  for (auto primeNumber : PrimeRange(minNumber, maxNumber)) {
+    callback(primeNumber);
+  }
+}
+
+auto findPrimeNumbers(Number maxNumber, Opt<unsigned> maxThreads)
+    -> std::vector<Number> {
+  auto numThreads = maxThreads ? maxThreads.value() : getNumberOfCpus();
+
+  if (maxNumber <= MAX_SEQUENTIAL_NUMBER) {
+    return findPrimeNumbersSequentially(maxNumber);
+  }
+
+  numThreads = std::max(numThreads, 1U);
+  auto basePrimes = findBasePrimes(maxNumber, numThreads);
+  auto basePrimesMax = basePrimes.back() + 1;
+  return findPrimeNumbersInSegments(std::move(basePrimes), basePrimesMax,
+                                    maxNumber, numThreads);
+}
+
+auto countPrimes(Number minNumber, Number maxNumber,
+                 Opt<unsigned> maxThreads) -> Number {
+  auto numThreads = maxThreads ? maxThreads.value() : getNumberOfCpus();
+
+  auto numPrimes = Number(minNumber <= 2 && 2 < maxNumber);
+  minNumber = std::max(minNumber, Number(3));
+  if (minNumber >= maxNumber) {
+    return numPrimes;
+  }
+
+  auto segmentCounts = std::vector<Number>(countSegments(minNumber, maxNumber));
+  sieveSegmentsInParallel(
+      findBasePrimes(maxNumber, 1), minNumber, maxNumber,
+      std::max(numThreads, 1U),
+      [&](std::size_t segment, const SegmentedSieve &sieve) {
+        segmentCounts[segment] = sieve.countPrimes();
+      });
+  return std::accumulate(segmentCounts.begin(), segmentCounts.end(),
+                         numPrimes);
+}
+
+}  // namespace numbers
@@ -1,16 +1,73 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
 #include <optional>
 #include <vector>
 
 namespace numbers {
 
-using Number = unsigned int;
+using Number = std::uint64_t;
 
 template <class T>
 using Opt = std::optional<T>;
 
+// The sieves below keep the primes under sqrt(maxNumber) in memory, shared by
+// all threads, and every thread adds 8 bytes of state per such prime. Near
+// maxNumber = 1e18 that is about 400 MB plus 400 MB per thread, which is the
+// practical upper bound.
 auto findPrimeNumbers(Number maxNumber, Opt<unsigned> maxThreads = {})
     -> std::vector<Number>;
 
+auto countPrimes(Number minNumber, Number maxNumber,
+                 Opt<unsigned> maxThreads = {}) -> Number;
+
+class PrimeRange {
+ public:
+  class Iterator {
+   public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = Number;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const Number *;
+    using reference = const Number &;
+
+    Iterator() = default;
+    explicit Iterator(PrimeRange *range);
+
+    auto operator*() const -> const Number & { return range_->primes_[index_]; }
+    auto operator++() -> Iterator &;
+    bool operator==(const Iterator &other) const {
+      return range_ == other.range_ && index_ == other.index_;
+    }
+    bool operator!=(const Iterator &other) const { return !(*this == other); }
+
+   private:
+    PrimeRange *range_{};
+    std::size_t index_{};
+  };
+
+  PrimeRange(Number minNumber, Number maxNumber);
+  PrimeRange(PrimeRange &&) noexcept;
+  auto operator=(PrimeRange &&) noexcept -> PrimeRange &;
+  ~PrimeRange();
+
+  auto begin() -> Iterator { return Iterator(this); }
+  auto end() -> Iterator { return Iterator(); }
+
+ private:
+  struct Generator;
+
+  std::unique_ptr<Generator> generator_;
+  std::vector<Number> primes_{};
+
+  bool fetchPrimes();
+};
+
+void forEachPrime(Number minNumber, Number maxNumber,
+                  const std::function<void(Number)> &callback);
+
 }  // namespace numbers
\ No newline at end of file
@@ -1,6 +1,8 @@
 
 #include <gtest/gtest.h>
 
+#include <future>
+
 #include "sieve_of_eratosthenes.h"
 
 namespace numbers {
@@ -114,4 +116,218 @@ auto TestSieveOfEratosthenes_Parallel::getTestName(
          std::to_string(maxThreads);
 }
 
+TEST(TestSieveOfEratosthenes_Concurrent, testConcurrentCalls) {
+  constexpr auto MAX_NUMBER = Number(1'000'000);
+  constexpr auto NUM_CALLERS = 4;
+
+  constexpr auto ONE_THREAD = 1;
+  auto expectedResults = findPrimeNumbers(MAX_NUMBER, ONE_THREAD);
+
+  auto callers = std::vector<std::future<std::vector<Number>>>();
+  for (auto caller = 0U; caller < NUM_CALLERS; caller++) {
+    callers.push_back(std::async(std::launch::async, [caller]() {
+      return findPrimeNumbers(MAX_NUMBER, 1 + caller * 3);
+    }));
+  }
+  for (auto &caller : callers) {
+    EXPECT_EQ(expectedResults, caller.get());
+  }
+}
+
+// --- TestSieveOfEratosthenes_Segmented ---
+
+class TestSieveOfEratosthenes_Segmented
+    : public ::testing::TestWithParam<TestCase_Parallel> {
+ public:
+  using TestCase = TestCase_Parallel;
+
+  static auto getTestName(const ::testing::TestParamInfo<TestCase> &testInfo)
+      -> std::string {
+    return TestSieveOfEratosthenes_Parallel::getTestName(testInfo);
+  }
+
+ protected:
+  static auto findPrimeNumbersNaively(Number maxNumber) -> std::vector<Number>;
+};
+
+INSTANTIATE_TEST_SUITE_P(
+    TestSieveOfEratosthenes_Segmented, TestSieveOfEratosthenes_Segmented,
+    ::testing::Combine(::testing::Values(10'001, 10'202, 262'143, 262'145,
+                                         524'289, 3'000'017),
+                       ::testing::Values(1, 3, 16)),
+    &TestSieveOfEratosthenes_Segmented::getTestName);
+
+TEST_P(TestSieveOfEratosthenes_Segmented, testSegmented) {
+  auto [maxNumber, maxThreads] = GetParam();
+  EXPECT_EQ(findPrimeNumbersNaively(maxNumber),
+            findPrimeNumbers(maxNumber, maxThreads));
+}
+
+// --- TestPrimeRange ---
+
+using MinNumber = Number;
+using TestCase_PrimeRange = std::tuple<MinNumber, MaxNumber>;
+
+class TestPrimeRange : public ::testing::TestWithParam<TestCase_PrimeRange> {
+ public:
+  using TestCase = TestCase_PrimeRange;
+
+  static auto getTestName(const ::testing::TestParamInfo<TestCase> &testInfo)
+      -> std::string {
+    auto [minNumber, maxNumber] = testInfo.param;
+    return "minNumber_" + std::to_string(minNumber) + "_maxNumber_" +
+           std::to_string(maxNumber);
+  }
+
+ protected:
+  static bool isPrime(Number number) {
+    if (number < 2) return false;
+    for (auto divisor = Number(2); divisor <= number / divisor; divisor++) {
+      if (number % divisor == 0) return false;
+    }
+    return true;
+  }
+};
+
+INSTANTIATE_TEST_SUITE_P(
+    TestPrimeRange, TestPrimeRange,
+    testing::Values(TestCase_PrimeRange{0, 0}, TestCase_PrimeRange{0, 3},
+                    TestCase_PrimeRange{2, 3}, TestCase_PrimeRange{3, 3},
+                    TestCase_PrimeRange{1, 100}, TestCase_PrimeRange{4, 5},
+                    TestCase_PrimeRange{100, 10},
+                    TestCase_PrimeRange{24, 29},
+                    TestCase_PrimeRange{11, 17},
+                    TestCase_PrimeRange{13, 14},
+                    TestCase_PrimeRange{30'000, 90'000},
+                    TestCase_PrimeRange{10'000, 2'000'000},
+                    TestCase_PrimeRange{1'000'000'000, 1'000'100'000},
+                    TestCase_PrimeRange{4'294'900'000, 4'294'967'295},
+                    TestCase_PrimeRange{4'294'900'000, 4'295'100'000},
+                    TestCase_PrimeRange{1'000'000'000'000,
+                                        1'000'000'010'000}),
+    &TestPrimeRange::getTestName);
+
+TEST_P(TestPrimeRange, testPrimeRange) {
+  auto [minNumber, maxNumber] = GetParam();
+
+  auto expectedPrimes = std::vector<Number>();
+  for (auto number = minNumber; number < maxNumber; number++) {
+    if (isPrime(number)) {
+      expectedPrimes.push_back(number);
+    }
+  }
+
+  auto actualPrimes = std::vector<Number>();
+  for (auto primeNumber : PrimeRange(minNumber, maxNumber)) {
+    actualPrimes.push_back(primeNumber);
+  }
+  EXPECT_EQ(expectedPrimes, actualPrimes);
+
+  actualPrimes.clear();
+  forEachPrime(minNumber, maxNumber, [&actualPrimes](Number primeNumber) {
+    actualPrimes.push_back(primeNumber);
+  });
+  EXPECT_EQ(expectedPrimes, actualPrimes);
+}
+
+// --- TestPrimeRange_Windows ---
+
+TEST(TestPrimeRange_Windows, testAgainstWindowSieve) {
+  for (auto [minNumber, maxNumber] :
+       {std::pair<Number, Number>{1'000'000'000'000, 1'000'003'000'000},
+        std::pair<Number, Number>{100'000'000'000'000,
+                                  100'000'002'000'000}}) {
+    auto isComposite = std::vector<bool>(maxNumber - minNumber);
+    for (auto divisor = Number(2); divisor <= (maxNumber - 1) / divisor;
+         divisor++) {
+      auto multiple = std::max(divisor * divisor,
+                               (minNumber + divisor - 1) / divisor * divisor);
+      for (; multiple < maxNumber; multiple += divisor) {
+        isComposite[multiple - minNumber] = true;
+      }
+    }
+    auto expectedPrimes = std::vector<Number>();
+    for (auto number = minNumber; number < maxNumber; number++) {
+      if (!isComposite[number - minNumber]) {
+        expectedPrimes.push_back(number);
+      }
+    }
+
+    auto actualPrimes = std::vector<Number>();
+    for (auto primeNumber : PrimeRange(minNumber, maxNumber)) {
+      actualPrimes.push_back(primeNumber);
+    }
+    EXPECT_EQ(expectedPrimes, actualPrimes);
+    EXPECT_EQ(expectedPrimes.size(), countPrimes(minNumber, maxNumber));
+  }
+}
+
+// --- TestCountPrimes ---
+
+using ExpectedCount = Number;
+using TestCase_CountPrimes = std::tuple<MinNumber, MaxNumber, ExpectedCount>;
+
+class TestCountPrimes : public ::testing::TestWithParam<TestCase_CountPrimes> {
+ public:
+  using TestCase = TestCase_CountPrimes;
+
+  static auto getTestName(const ::testing::TestParamInfo<TestCase> &testInfo)
+      -> std::string {
+    auto [minNumber, maxNumber, expectedCount] = testInfo.param;
+    return "minNumber_" + std::to_string(minNumber) + "_maxNumber_" +
+           std::to_string(maxNumber);
+  }
+};
+
+INSTANTIATE_TEST_SUITE_P(
+    TestCountPrimes, TestCountPrimes,
+    testing::Values(TestCase_CountPrimes{0, 0, 0},
+                    TestCase_CountPrimes{0, 3, 1},
+                    TestCase_CountPrimes{2, 3, 1},
+                    TestCase_CountPrimes{3, 3, 0},
+                    TestCase_CountPrimes{100, 10, 0},
+                    TestCase_CountPrimes{0, 10, 4},
+                    TestCase_CountPrimes{0, 100, 25},
+                    TestCase_CountPrimes{24, 29, 0},
+                    TestCase_CountPrimes{24, 30, 1},
+                    TestCase_CountPrimes{0, 1'000'000, 78'498},
+                    TestCase_CountPrimes{1'000'000, 10'000'000, 586'081},
+                    TestCase_CountPrimes{0, 100'000'000, 5'761'455}),
+    &TestCountPrimes::getTestName);
+
+TEST_P(TestCountPrimes, testCountPrimes) {
+  auto [minNumber, maxNumber, expectedCount] = GetParam();
+  for (auto maxThreads : {1U, 2U, 4U}) {
+    EXPECT_EQ(expectedCount, countPrimes(minNumber, maxNumber, maxThreads));
+  }
+}
+
+TEST(TestCountPrimes_Windows, testAgainstPrimeRange) {
+  for (auto [minNumber, maxNumber] :
+       {std::pair<Number, Number>{4'294'000'000, 4'296'000'000},
+        std::pair<Number, Number>{1'000'000'000'000, 1'000'002'000'000}}) {
+    auto expectedCount = Number();
+    for ([[maybe_unused]] auto primeNumber : PrimeRange(minNumber, maxNumber)) {
+      expectedCount++;
+    }
+    EXPECT_EQ(expectedCount, countPrimes(minNumber, maxNumber))
+        << "minNumber=" << minNumber << " maxNumber=" << maxNumber;
+  }
+}
+
+auto TestSieveOfEratosthenes_Segmented::findPrimeNumbersNaively(
+    Number maxNumber) -> std::vector<Number> {
+  auto isComposite = std::vector<bool>(maxNumber);
+  auto primeNumbers = std::vector<Number>();
+  for (auto x = Number(2); x < maxNumber; x++) {
+    if (isComposite[x]) continue;
+    primeNumbers.push_back(x);
+    for (auto multiple = std::uint64_t(x) * x; multiple < maxNumber;
+         multiple += x) {
+      isComposite[multiple] = true;
+    }
+  }
+  return primeNumbers;
+}
+
 }  // namespace numbers